@@ -452,8 +452,6 @@ reg_t kFont(EngineState *s, int argc, reg_t *argv) {
 // TODO: Eventually, all of the kBitmap operations should be put
 // in a separate class
 
-#define BITMAP_HEADER_SIZE 46
-
 reg_t kBitmap(EngineState *s, int argc, reg_t *argv) {
 	// Used for bitmap operations in SCI2.1 and SCI3.
 	// This is the SCI2.1 version, the functionality seems to have changed in SCI3.
@@ -61,6 +61,9 @@ enum {
 
 #define HUGE_DISTANCE 0xFFFFFFFF
 
+// Number of polygon sets to keep visibility graphs for
+#define AVOIDPATH_MAX_GRAPHS 4
+
 #define VERTEX_HAS_EDGES(V) ((V) != CLIST_NEXT(V))
 
 // Error codes
@@ -111,23 +114,26 @@ struct Vertex {
 	// Previous vertex in shortest path
 	Vertex *path_prev;
 
+	// A* set membership, and the order in which vertices entered the open set
+	bool open;
+	bool closed;
+	uint32 openOrder;
+
+	// Position in the vertex index
+	int index;
+
 public:
 	Vertex(const Common::Point &p) : v(p) {
 		costG = HUGE_DISTANCE;
 		path_prev = NULL;
+		open = false;
+		closed = false;
+		openOrder = 0;
+		index = -1;
 	}
 };
 
-class VertexList: public Common::List<Vertex *> {
-public:
-	bool contains(Vertex *v) {
-		for (iterator it = begin(); it != end(); ++it) {
-			if (v == *it)
-				return true;
-		}
-		return false;
-	}
-};
+typedef Common::Array<Vertex *> VertexList;
 
 /* Circular list definitions. */
 
@@ -250,6 +256,14 @@ struct PathfindingState {
 	// Total number of vertices
 	int vertices;
 
+	// Cached visibility graph of the polygon vertices, or NULL if it can't
+	// be used. The start and end vertices aren't part of it.
+	const AvoidPathGraph *_graph;
+
+	// For each vertex, whether it is visible from the start or end vertex
+	Common::Array<bool> _visibleFromStart;
+	Common::Array<bool> _visibleFromEnd;
+
 	// Point to prepend and append to final path
 	Common::Point *_prependPoint;
 	Common::Point *_appendPoint;
@@ -264,6 +278,7 @@ struct PathfindingState {
 		_prependPoint = NULL;
 		_appendPoint = NULL;
 		vertices = 0;
+		_graph = NULL;
 	}
 
 	~PathfindingState() {
@@ -660,45 +675,69 @@ static int inside(const Common::Point &p, Vertex *vertex) {
 }
 
 /**
- * Returns a list of all vertices that are visible from a particular vertex.
+ * Determines whether or not a vertex is visible from another vertex, i.e.
+ * whether the line between them doesn't intersect any polygon. This relation
+ * is symmetric.
  * @param s				the pathfinding state
- * @param vertex_cur	the vertex
- * @return list of vertices that are visible from vert
+ * @param vertex_cur	the first vertex
+ * @param vertex		the second vertex
+ * @return true if vertex is visible from vertex_cur, false otherwise
  */
-static VertexList *visible_vertices(PathfindingState *s, Vertex *vertex_cur) {
-	VertexList *visVerts = new VertexList();
-
-	for (int i = 0; i < s->vertices; i++) {
-		Vertex *vertex = s->vertex_index[i];
-
-		// Make sure we don't intersect a polygon locally at the vertices
-		if ((vertex == vertex_cur) || (inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
-			continue;
+static bool is_visible(PathfindingState *s, Vertex *vertex_cur, Vertex *vertex) {
+	// Make sure we don't intersect a polygon locally at the vertices
+	if ((vertex == vertex_cur) || (inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
+		return false;
 
-		// Check for intersecting edges
-		int j;
-		for (j = 0; j < s->vertices; j++) {
-			Vertex *edge = s->vertex_index[j];
-			if (VERTEX_HAS_EDGES(edge)) {
-				if (between(vertex_cur->v, vertex->v, edge->v)) {
-					// If we hit a vertex, make sure we can pass through it without intersecting its polygon
-					if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
-						break;
-
-					// This edge won't properly intersect, so we continue
-					continue;
-				}
+	// Check for intersecting edges
+	for (int j = 0; j < s->vertices; j++) {
+		Vertex *edge = s->vertex_index[j];
+		if (VERTEX_HAS_EDGES(edge)) {
+			if (between(vertex_cur->v, vertex->v, edge->v)) {
+				// If we hit a vertex, make sure we can pass through it without intersecting its polygon
+				if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
+					return false;
 
-				if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
-					break;
+				// This edge won't properly intersect, so we continue
+				continue;
 			}
+
+			if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
+				return false;
 		}
+	}
 
-		if (j == s->vertices)
-			visVerts->push_front(vertex);
+	return true;
+}
+
+/**
+ * Returns a list of all vertices that are visible from a particular vertex,
+ * ordered by descending vertex index.
+ * @param s				the pathfinding state
+ * @param vertex_cur	the vertex
+ * @param visVerts		list to store the vertices that are visible from vert
+ */
+static void visible_vertices(PathfindingState *s, Vertex *vertex_cur, VertexList &visVerts) {
+	visVerts.clear();
+
+	if (s->_graph && vertex_cur != s->vertex_start && vertex_cur != s->vertex_end) {
+		// The start and end vertices are the first two in the index, so
+		// they go last
+		const Common::Array<uint16> &visible = s->_graph->visible[vertex_cur->index - 2];
+		for (uint i = 0; i < visible.size(); i++)
+			visVerts.push_back(s->vertex_index[visible[i] + 2]);
+		if (s->_visibleFromStart[vertex_cur->index])
+			visVerts.push_back(s->vertex_start);
+		if (s->_visibleFromEnd[vertex_cur->index])
+			visVerts.push_back(s->vertex_end);
+		return;
 	}
 
-	return visVerts;
+	for (int i = s->vertices - 1; i >= 0; i--) {
+		Vertex *vertex = s->vertex_index[i];
+
+		if (is_visible(s, vertex_cur, vertex))
+			visVerts.push_back(vertex);
+	}
 }
 
 /**
@@ -1293,6 +1332,7 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
 		Vertex *vertex;
 
 		CLIST_FOREACH(vertex, &polygon->vertices) {
+			vertex->index = count;
 			pf_s->vertex_index[count++] = vertex;
 		}
 	}
@@ -1302,6 +1342,151 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
 	return pf_s;
 }
 
+/**
+ * Looks up the visibility graph of the polygon set in the cache, and builds
+ * it if necessary. The graph can only be used when the start and end points
+ * didn't have to be merged into any of the polygons, as they would otherwise
+ * change the polygon edges.
+ * Parameters: (EngineState *) s: The game state
+ *             (PathfindingState *) p: The pathfinding state
+ */
+static void setup_visibility_graph(EngineState *s, PathfindingState *p) {
+	// merge_point() adds single-vertex polygons at the front of the list
+	if (p->vertices < 2 || p->vertex_index[0] != p->vertex_end || p->vertex_index[1] != p->vertex_start ||
+			VERTEX_HAS_EDGES(p->vertex_start) || VERTEX_HAS_EDGES(p->vertex_end))
+		return;
+
+	Common::Array<Common::Point> points;
+	Common::Array<uint16> polygonSizes;
+	points.reserve(p->vertices - 2);
+
+	for (int i = 2; i < p->vertices; i++)
+		points.push_back(p->vertex_index[i]->v);
+
+	PolygonList::iterator it = p->polygons.begin();
+	for (++it, ++it; it != p->polygons.end(); ++it) {
+		Vertex *vertex;
+		uint16 size = 0;
+
+		CLIST_FOREACH(vertex, &(*it)->vertices)
+			size++;
+
+		polygonSizes.push_back(size);
+	}
+
+	AvoidPathGraphList &graphs = s->_avoidPathGraphs;
+	AvoidPathGraph *graph = NULL;
+
+	for (AvoidPathGraphList::iterator g = graphs.begin(); g != graphs.end(); ++g) {
+		if (g->points == points && g->polygonSizes == polygonSizes) {
+			graph = &(*g);
+			break;
+		}
+	}
+
+	if (graph) {
+		debugC(kDebugLevelAvoidPath, "[avoidpath] Using cached visibility graph (%d vertices)", points.size());
+	} else {
+		// Make room by dropping the least recently used graph
+		if (graphs.size() >= AVOIDPATH_MAX_GRAPHS) {
+			AvoidPathGraphList::iterator oldest = graphs.begin();
+			for (AvoidPathGraphList::iterator g = graphs.begin(); g != graphs.end(); ++g) {
+				if (g->lastUsed < oldest->lastUsed)
+					oldest = g;
+			}
+			graphs.erase(oldest);
+		}
+
+		graphs.push_back(AvoidPathGraph());
+		graph = &graphs.back();
+		graph->points = points;
+		graph->polygonSizes = polygonSizes;
+		graph->visible.resize(points.size());
+
+		// Visibility is symmetric, so each pair only needs to be checked
+		// once. Going backwards keeps the lists in descending order.
+		for (int i = points.size() - 1; i >= 0; i--) {
+			for (int j = i - 1; j >= 0; j--) {
+				if (is_visible(p, p->vertex_index[i + 2], p->vertex_index[j + 2])) {
+					graph->visible[i].push_back(j);
+					graph->visible[j].push_back(i);
+				}
+			}
+		}
+
+		debugC(kDebugLevelAvoidPath, "[avoidpath] Built visibility graph (%d vertices)", points.size());
+	}
+
+	graph->lastUsed = ++s->_avoidPathCounter;
+
+	// The start and end vertices are checked against the graph separately
+	VertexList visVerts;
+	p->_visibleFromStart.resize(p->vertices);
+	p->_visibleFromEnd.resize(p->vertices);
+
+	visible_vertices(p, p->vertex_start, visVerts);
+	for (uint i = 0; i < visVerts.size(); i++)
+		p->_visibleFromStart[visVerts[i]->index] = true;
+
+	visible_vertices(p, p->vertex_end, visVerts);
+	for (uint i = 0; i < visVerts.size(); i++)
+		p->_visibleFromEnd[visVerts[i]->index] = true;
+
+	p->_graph = graph;
+}
+
+struct OpenSetEntry {
+	uint32 costF;
+	uint32 openOrder;
+	Vertex *vertex;
+
+	OpenSetEntry(Vertex *v) : costF(v->costF), openOrder(v->openOrder), vertex(v) {}
+};
+
+/**
+ * Determines which of two open set entries has to be expanded first: the one
+ * with the lowest F cost, or on ties, the one which was added last.
+ */
+static bool openSetBefore(const OpenSetEntry &a, const OpenSetEntry &b) {
+	if (a.costF != b.costF)
+		return a.costF < b.costF;
+	return a.openOrder > b.openOrder;
+}
+
+static void openSetPush(Common::Array<OpenSetEntry> &heap, const OpenSetEntry &entry) {
+	uint i = heap.size();
+	heap.push_back(entry);
+
+	while (i > 0) {
+		uint parent = (i - 1) / 2;
+		if (!openSetBefore(heap[i], heap[parent]))
+			break;
+		SWAP(heap[i], heap[parent]);
+		i = parent;
+	}
+}
+
+static OpenSetEntry openSetPop(Common::Array<OpenSetEntry> &heap) {
+	OpenSetEntry top = heap[0];
+	heap[0] = heap.back();
+	heap.pop_back();
+
+	uint i = 0;
+	for (;;) {
+		uint child = 2 * i + 1;
+		if (child >= heap.size())
+			break;
+		if (child + 1 < heap.size() && openSetBefore(heap[child + 1], heap[child]))
+			child++;
+		if (!openSetBefore(heap[child], heap[i]))
+			break;
+		SWAP(heap[i], heap[child]);
+		i = child;
+	}
+
+	return top;
+}
+
 /**
  * Computes a shortest path from vertex_start to vertex_end. The caller can
  * construct the resulting path by following the path_prev links from
@@ -1310,52 +1495,52 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
  * Parameters: (PathfindingState *) s: The pathfinding state
  */
 static void AStar(PathfindingState *s) {
-	// Vertices of which the shortest path is known
-	VertexList closedSet;
+	// The open set is kept in a binary heap. Vertices are not removed from it
+	// when their cost decreases; instead, a new entry is added and outdated
+	// entries are skipped.
+	Common::Array<OpenSetEntry> openSet;
+	uint32 openOrder = 0;
+	bool found = false;
 
-	// The remaining vertices
-	VertexList openSet;
+	VertexList visVerts;
 
-	openSet.push_front(s->vertex_start);
 	s->vertex_start->costG = 0;
 	s->vertex_start->costF = (uint32)sqrt((float)s->vertex_start->v.sqrDist(s->vertex_end->v));
+	s->vertex_start->open = true;
+	s->vertex_start->openOrder = openOrder++;
+	openSetPush(openSet, OpenSetEntry(s->vertex_start));
 
 	while (!openSet.empty()) {
 		// Find vertex in open set with lowest F cost
-		VertexList::iterator vertex_min_it = openSet.end();
-		Vertex *vertex_min = 0;
-		uint32 min = HUGE_DISTANCE;
-
-		for (VertexList::iterator it = openSet.begin(); it != openSet.end(); ++it) {
-			Vertex *vertex = *it;
-			if (vertex->costF < min) {
-				vertex_min_it = it;
-				vertex_min = *vertex_min_it;
-				min = vertex->costF;
-			}
-		}
+		OpenSetEntry entry = openSetPop(openSet);
+		Vertex *vertex_min = entry.vertex;
 
-		assert(vertex_min != 0);	// the vertex cost should never be bigger than HUGE_DISTANCE
+		if (vertex_min->closed || entry.costF != vertex_min->costF)
+			continue;
 
 		// Check if we are done
-		if (vertex_min == s->vertex_end)
+		if (vertex_min == s->vertex_end) {
+			found = true;
 			break;
+		}
 
 		// Move vertex from set open to set closed
-		closedSet.push_front(vertex_min);
-		openSet.erase(vertex_min_it);
+		vertex_min->open = false;
+		vertex_min->closed = true;
 
-		VertexList *visVerts = visible_vertices(s, vertex_min);
+		visible_vertices(s, vertex_min, visVerts);
 
-		for (VertexList::iterator it = visVerts->begin(); it != visVerts->end(); ++it) {
+		for (VertexList::iterator it = visVerts.begin(); it != visVerts.end(); ++it) {
 			uint32 new_dist;
 			Vertex *vertex = *it;
 
-			if (closedSet.contains(vertex))
+			if (vertex->closed)
 				continue;
 
-			if (!openSet.contains(vertex))
-				openSet.push_front(vertex);
+			if (!vertex->open) {
+				vertex->open = true;
+				vertex->openOrder = openOrder++;
+			}
 
 			new_dist = vertex_min->costG + (uint32)sqrt((float)vertex_min->v.sqrDist(vertex->v));
 
@@ -1382,13 +1567,12 @@ static void AStar(PathfindingState *s) {
 				vertex->costG = new_dist;
 				vertex->costF = vertex->costG + (uint32)sqrt((float)vertex->v.sqrDist(s->vertex_end->v));
 				vertex->path_prev = vertex_min;
+				openSetPush(openSet, OpenSetEntry(vertex));
 			}
 		}
-
-		delete visVerts;
 	}
 
-	if (openSet.empty())
+	if (!found)
 		debugC(kDebugLevelAvoidPath, "AvoidPath: End point (%i, %i) is unreachable", s->vertex_end->v.x, s->vertex_end->v.y);
 }
 
@@ -1563,6 +1747,8 @@ reg_t kAvoidPath(EngineState *s, int argc, reg_t *argv) {
 			return output;
 		}
 
+		setup_visibility_graph(s, p);
+
 		// Apply Dijkstra
 		AStar(p);
 
@@ -41,6 +41,7 @@
 #include "sci/video/seq_decoder.h"
 #ifdef ENABLE_SCI32
 #include "video/coktel_decoder.h"
+#include "sci/graphics/frameout.h"
 #include "sci/video/robot_decoder.h"
 #endif
 
@@ -127,6 +128,12 @@ void playVideo(Video::VideoDecoder *videoDecoder, VideoState videoState) {
 		g_system->delayMillis(10);
 	}
 
+#ifdef ENABLE_SCI32
+	// The video has been drawn over the game screen
+	if (g_sci->_gfxFrameout)
+		g_sci->_gfxFrameout->invalidateScreen();
+#endif
+
 	delete[] scaleBuffer;
 	delete videoDecoder;
 }
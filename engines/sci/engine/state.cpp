@@ -73,7 +73,7 @@ EngineState::EngineState(SegManager *segMan)
 #ifdef ENABLE_SCI32
 	_virtualIndexFile(0),
 #endif
-	_dirseeker() {
+	_dirseeker(), _avoidPathCounter(0) {
 
 	reset(false);
 }
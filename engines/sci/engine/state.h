@@ -25,6 +25,8 @@
 
 #include "common/scummsys.h"
 #include "common/array.h"
+#include "common/list.h"
+#include "common/rect.h"
 #include "common/serializer.h"
 #include "common/str-array.h"
 
@@ -83,6 +85,24 @@ enum VideoFlags {
 	kStretch         = 1 << 8
 };
 
+/**
+ * Visibility graph between the vertices of a polygon set, as used by
+ * kAvoidPath. Vertices are numbered in the order they are read from the
+ * polygon list.
+ */
+struct AvoidPathGraph {
+	// The polygon set this graph belongs to
+	Common::Array<Common::Point> points;
+	Common::Array<uint16> polygonSizes;
+
+	// For each vertex, the vertices visible from it, in descending order
+	Common::Array<Common::Array<uint16> > visible;
+
+	uint32 lastUsed;
+};
+
+typedef Common::List<AvoidPathGraph> AvoidPathGraphList;
+
 struct VideoState {
 	Common::String fileName;
 	uint16 x;
@@ -201,6 +221,10 @@ public:
 
 	uint16 _palCycleToColor;
 
+	// Visibility graphs of the most recently used kAvoidPath polygon sets
+	AvoidPathGraphList _avoidPathGraphs;
+	uint32 _avoidPathCounter;
+
 	/**
 	 * Resets the engine state.
 	 */
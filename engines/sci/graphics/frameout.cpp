@@ -59,6 +59,10 @@ enum SciSpeciaPlanelPictureCodes {
 	kPlanePlainColored = 0xffff		// -1
 };
 
+enum {
+	kMaxDirtyRects = 16	// past this, the whole screen gets copied
+};
+
 GfxFrameout::GfxFrameout(SegManager *segMan, ResourceManager *resMan, GfxCoordAdjuster *coordAdjuster, GfxCache *cache, GfxScreen *screen, GfxPalette *palette, GfxPaint32 *paint32)
 	: _segMan(segMan), _resMan(resMan), _cache(cache), _screen(screen), _palette(palette), _paint32(paint32) {
 
@@ -66,6 +70,8 @@ GfxFrameout::GfxFrameout(SegManager *segMan, ResourceManager *resMan, GfxCoordAd
 	_curScrollText = -1;
 	_showScrollText = false;
 	_maxScrollTexts = 0;
+	_drawnScrollText = NULL_REG;
+	_fullRedraw = true;
 }
 
 GfxFrameout::~GfxFrameout() {
@@ -77,6 +83,8 @@ void GfxFrameout::clear() {
 	_planes.clear();
 	deletePlanePictures(NULL_REG);
 	clearScrollTexts();
+	_dirtyRects.clear();
+	invalidateScreen();
 }
 
 void GfxFrameout::clearScrollTexts() {
@@ -160,6 +168,7 @@ void GfxFrameout::kernelAddPlane(reg_t object) {
 	newPlane.pictureId = kPlanePlainColored;
 	newPlane.planePictureMirrored = false;
 	newPlane.planeBack = 0;
+	newPlane.drawn = PlaneDrawState();
 	_planes.push_back(newPlane);
 
 	kernelUpdatePlane(object);
@@ -246,6 +255,8 @@ void GfxFrameout::kernelDeletePlane(reg_t object) {
 
 	for (PlaneList::iterator it = _planes.begin(); it != _planes.end(); ++it) {
 		if (it->object == object) {
+			if (it->drawn.visible)
+				addDirtyRect(it->drawn.rect);
 			_planes.erase(it);
 			Common::Rect planeRect;
 			planeRect.top = readSelectorValue(_segMan, object, SELECTOR(top));
@@ -258,6 +269,7 @@ void GfxFrameout::kernelDeletePlane(reg_t object) {
 
 			// Blackout removed plane rect
 			_paint32->fillRect(planeRect, 0);
+			addDirtyRect(toDisplayRect(planeRect));
 			return;
 		}
 	}
@@ -275,6 +287,7 @@ void GfxFrameout::addPlanePicture(reg_t object, GuiResourceId pictureId, uint16
 	newPicture.startY = startY;
 	newPicture.pictureCels = 0;
 	_planePictures.push_back(newPicture);
+	addDirtyPlane(object);
 }
 
 void GfxFrameout::deletePlanePictures(reg_t object) {
@@ -282,7 +295,8 @@ void GfxFrameout::deletePlanePictures(reg_t object) {
 
 	while (it != _planePictures.end()) {
 		if (it->object == object || object.isNull()) {
-			delete it->pictureCels;
+			addDirtyPlane(it->object);
+			delete[] it->pictureCels;
 			delete it->picture;
 			it = _planePictures.erase(it);
 		} else {
@@ -303,6 +317,8 @@ reg_t GfxFrameout::addPlaneLine(reg_t object, Common::Point startPoint, Common::
 			line.priority = priority;
 			line.control = control;
 			it->lines.push_back(line);
+			// Lines aren't clipped against their plane
+			invalidateScreen();
 			return line.hunkId;
 		}
 	}
@@ -324,6 +340,7 @@ void GfxFrameout::updatePlaneLine(reg_t object, reg_t hunkId, Common::Point star
 					it2->color = color;
 					it2->priority = priority;
 					it2->control = control;
+					invalidateScreen();
 					return;
 				}
 			}
@@ -342,6 +359,7 @@ void GfxFrameout::deletePlaneLine(reg_t object, reg_t hunkId) {
 				if (it2->hunkId == hunkId) {
 					_segMan->freeHunkEntry(hunkId);
 					it2 = it->lines.erase(it2);
+					invalidateScreen();
 					return;
 				}
 			}
@@ -442,6 +460,8 @@ void GfxFrameout::kernelDeleteScreenItem(reg_t object) {
 	if (!itemEntry)
 		return;
 
+	if (itemEntry->drawn.visible)
+		addDirtyRect(itemEntry->drawn.rect);
 	_screenItems.remove(itemEntry);
 	delete itemEntry;
 }
@@ -460,6 +480,8 @@ void GfxFrameout::deletePlaneItems(reg_t planeObject) {
 
 		if (objectMatches) {
 			FrameoutEntry *itemEntry = *listIterator;
+			if (itemEntry->drawn.visible)
+				addDirtyRect(itemEntry->drawn.rect);
 			listIterator = _screenItems.erase(listIterator);
 			delete itemEntry;
 		} else {
@@ -509,10 +531,13 @@ bool planeSortHelper(const PlaneEntry &entry1, const PlaneEntry &entry2) {
 void GfxFrameout::sortPlanes() {
 	// First, remove any invalid planes
 	for (PlaneList::iterator it = _planes.begin(); it != _planes.end();) {
-		if (!_segMan->isObject(it->object))
+		if (!_segMan->isObject(it->object)) {
+			if (it->drawn.visible)
+				addDirtyRect(it->drawn.rect);
 			it = _planes.erase(it);
-		else
+		} else {
 			it++;
+		}
 	}
 
 	// Sort the rest of them
@@ -547,7 +572,10 @@ void GfxFrameout::showVideo() {
 				skipVideo = true;
 		}
 
-		g_system->delayMillis(10);
+		// Use the time until the next frame is due for decoding frames ahead,
+		// and only sleep when there is nothing left to decode
+		if (!videoDecoder->needsUpdate() && !videoDecoder->decodeAhead())
+			g_system->delayMillis(10);
 	}
 }
 
@@ -643,28 +671,266 @@ void GfxFrameout::drawPicture(FrameoutEntry *itemEntry, int16 planeOffsetX, int1
 	//	warning("picture cel %d %d", itemEntry->celNo, itemEntry->priority);
 }
 
+bool GfxFrameout::placeScreenItem(FrameoutEntry *itemEntry, const PlaneEntry &plane) {
+	GfxView *view = (itemEntry->viewId != 0xFFFF) ? _cache->getView(itemEntry->viewId) : NULL;
+	int16 dummyX = 0;
+
+	if (view && view->isSci2Hires()) {
+		view->adjustToUpscaledCoordinates(itemEntry->y, itemEntry->x);
+		view->adjustToUpscaledCoordinates(itemEntry->z, dummyX);
+	} else if (getSciVersion() >= SCI_VERSION_2_1) {
+		_coordAdjuster->fromScriptToDisplay(itemEntry->y, itemEntry->x);
+		_coordAdjuster->fromScriptToDisplay(itemEntry->z, dummyX);
+	}
+
+	// Adjust according to current scroll position
+	itemEntry->x -= plane.planeOffsetX;
+	itemEntry->y -= plane.planeOffsetY;
+
+	uint16 useInsetRect = readSelectorValue(_segMan, itemEntry->object, SELECTOR(useInsetRect));
+	if (useInsetRect) {
+		itemEntry->celRect.top = readSelectorValue(_segMan, itemEntry->object, SELECTOR(inTop));
+		itemEntry->celRect.left = readSelectorValue(_segMan, itemEntry->object, SELECTOR(inLeft));
+		itemEntry->celRect.bottom = readSelectorValue(_segMan, itemEntry->object, SELECTOR(inBottom));
+		itemEntry->celRect.right = readSelectorValue(_segMan, itemEntry->object, SELECTOR(inRight));
+		if (view && view->isSci2Hires()) {
+			view->adjustToUpscaledCoordinates(itemEntry->celRect.top, itemEntry->celRect.left);
+			view->adjustToUpscaledCoordinates(itemEntry->celRect.bottom, itemEntry->celRect.right);
+		}
+		itemEntry->celRect.translate(itemEntry->x, itemEntry->y);
+		// TODO: maybe we should clip the cels rect with this, i'm not sure
+		//  the only currently known usage is game menu of gk1
+	} else if (view) {
+		// Process global scaling, if needed.
+		// TODO: Seems like SCI32 always processes global scaling for scaled objects
+		// TODO: We can only process symmetrical scaling for now (i.e. same value for scaleX/scaleY)
+		if ((itemEntry->scaleSignal & kScaleSignalDoScaling32) &&
+		   !(itemEntry->scaleSignal & kScaleSignalDisableGlobalScaling32) &&
+		    (itemEntry->scaleX == itemEntry->scaleY))
+			applyGlobalScaling(itemEntry, plane.planeRect, view->getHeight(itemEntry->loopNo, itemEntry->celNo));
+
+		if ((itemEntry->scaleX == 128) && (itemEntry->scaleY == 128))
+			view->getCelRect(itemEntry->loopNo, itemEntry->celNo,
+				itemEntry->x, itemEntry->y, itemEntry->z, itemEntry->celRect);
+		else
+			view->getCelScaledRect(itemEntry->loopNo, itemEntry->celNo,
+				itemEntry->x, itemEntry->y, itemEntry->z, itemEntry->scaleX,
+				itemEntry->scaleY, itemEntry->celRect);
+
+		Common::Rect nsRect = itemEntry->celRect;
+		// Translate back to actual coordinate within scrollable plane
+		nsRect.translate(plane.planeOffsetX, plane.planeOffsetY);
+
+		if (g_sci->getGameId() == GID_PHANTASMAGORIA2) {
+			// HACK: Some (?) objects in Phantasmagoria 2 have no NS rect. Skip them for now.
+			// TODO: Remove once we figure out how Phantasmagoria 2 draws objects on screen.
+			if (lookupSelector(_segMan, itemEntry->object, SELECTOR(nsLeft), NULL, NULL) != kSelectorVariable)
+				return false;
+		}
+
+		if (view && view->isSci2Hires()) {
+			view->adjustBackUpscaledCoordinates(nsRect.top, nsRect.left);
+			view->adjustBackUpscaledCoordinates(nsRect.bottom, nsRect.right);
+			g_sci->_gfxCompare->setNSRect(itemEntry->object, nsRect);
+		} else if (getSciVersion() >= SCI_VERSION_2_1 && _resMan->detectHires()) {
+			_coordAdjuster->fromDisplayToScript(nsRect.top, nsRect.left);
+			_coordAdjuster->fromDisplayToScript(nsRect.bottom, nsRect.right);
+			g_sci->_gfxCompare->setNSRect(itemEntry->object, nsRect);
+		}
+	}
+
+	// Don't attempt to draw sprites that are outside the visible
+	// screen area. An example is the random people walking in
+	// Jackson Square in GK1.
+	if (itemEntry->celRect.bottom < 0 || itemEntry->celRect.top  >= _screen->getDisplayHeight() ||
+	    itemEntry->celRect.right  < 0 || itemEntry->celRect.left >= _screen->getDisplayWidth())
+		return false;
+
+	itemEntry->clipRect = itemEntry->celRect;
+
+	if (view && view->isSci2Hires()) {
+		itemEntry->clipRect.clip(plane.upscaledPlaneClipRect);
+		itemEntry->translatedClipRect = itemEntry->clipRect;
+		itemEntry->translatedClipRect.translate(plane.upscaledPlaneRect.left, plane.upscaledPlaneRect.top);
+	} else {
+		// QFG4 passes invalid rectangles when a battle is starting
+		if (!itemEntry->clipRect.isValidRect())
+			return false;
+		itemEntry->clipRect.clip(plane.planeClipRect);
+		itemEntry->translatedClipRect = itemEntry->clipRect;
+		itemEntry->translatedClipRect.translate(plane.planeRect.left, plane.planeRect.top);
+	}
+
+	return true;
+}
+
+void GfxFrameout::drawScreenItem(FrameoutEntry *itemEntry, const PlaneEntry &plane) {
+	GfxView *view = (itemEntry->viewId != 0xFFFF) ? _cache->getView(itemEntry->viewId) : NULL;
+
+	if (view && !itemEntry->clipRect.isEmpty()) {
+		if ((itemEntry->scaleX == 128) && (itemEntry->scaleY == 128))
+			view->draw(itemEntry->celRect, itemEntry->clipRect, itemEntry->translatedClipRect,
+				itemEntry->loopNo, itemEntry->celNo, 255, 0, view->isSci2Hires());
+		else
+			view->drawScaled(itemEntry->celRect, itemEntry->clipRect, itemEntry->translatedClipRect,
+				itemEntry->loopNo, itemEntry->celNo, 255, itemEntry->scaleX, itemEntry->scaleY);
+	}
+
+	// Draw text, if it exists
+	if (lookupSelector(_segMan, itemEntry->object, SELECTOR(text), NULL, NULL) == kSelectorVariable) {
+		g_sci->_gfxText32->drawTextBitmap(itemEntry->x, itemEntry->y, plane.planeRect, itemEntry->object);
+	}
+}
+
+void GfxFrameout::updateDrawState(FrameoutEntry *itemEntry, const PlaneEntry *plane) {
+	FrameoutDrawState state = FrameoutDrawState();
+
+	if (plane) {
+		state.visible = true;
+		state.plane = plane->object;
+		state.viewId = itemEntry->viewId;
+		state.loopNo = itemEntry->loopNo;
+		state.celNo = itemEntry->celNo;
+		state.priority = itemEntry->priority;
+		state.scaleX = itemEntry->scaleX;
+		state.scaleY = itemEntry->scaleY;
+		state.x = itemEntry->x;
+		state.y = itemEntry->y;
+
+		GfxView *view = (itemEntry->viewId != 0xFFFF) ? _cache->getView(itemEntry->viewId) : NULL;
+		if (view && !itemEntry->clipRect.isEmpty())
+			state.rect = view->isSci2Hires() ? itemEntry->translatedClipRect : toDisplayRect(itemEntry->translatedClipRect);
+
+		if (lookupSelector(_segMan, itemEntry->object, SELECTOR(text), NULL, NULL) == kSelectorVariable) {
+			// Text bitmaps may get rebuilt in place, so we compare their
+			// contents. Text can be positioned anywhere inside the plane,
+			// which also contains the cel.
+			state.textBitmap = readSelector(_segMan, itemEntry->object, SELECTOR(bitmap));
+			state.textChecksum = getTextChecksum(state.textBitmap);
+			state.textChecksum ^= readSelectorValue(_segMan, itemEntry->object, SELECTOR(back)) << 8;
+			state.textChecksum ^= readSelectorValue(_segMan, itemEntry->object, SELECTOR(skip)) << 16;
+			state.rect = plane->upscaledPlaneRect;
+		}
+	}
+
+	if (state != itemEntry->drawn) {
+		if (itemEntry->drawn.visible)
+			addDirtyRect(itemEntry->drawn.rect);
+		if (state.visible)
+			addDirtyRect(state.rect);
+		itemEntry->drawn = state;
+	}
+}
+
+uint32 GfxFrameout::getTextChecksum(reg_t bitmapHandle) {
+	if (bitmapHandle.isNull())
+		return 0;
+
+	byte *memoryPtr = _segMan->getHunkPointer(bitmapHandle);
+	if (!memoryPtr)
+		return 0;
+
+	uint32 size = READ_LE_UINT16(memoryPtr) * READ_LE_UINT16(memoryPtr + 2) + BITMAP_HEADER_SIZE;
+	uint32 checksum = 0;
+	for (uint32 i = 0; i < size; i++)
+		checksum = (checksum << 5) + checksum + memoryPtr[i];
+
+	return checksum;
+}
+
+Common::Rect GfxFrameout::toDisplayRect(Common::Rect rect) {
+	rect.clip(Common::Rect(_screen->getWidth(), _screen->getHeight()));
+	if (_screen->getUpscaledHires() && !rect.isEmpty()) {
+		_screen->adjustToUpscaledCoordinates(rect.top, rect.left);
+		_screen->adjustToUpscaledCoordinates(rect.bottom, rect.right);
+	}
+	return rect;
+}
+
+void GfxFrameout::addDirtyRect(const Common::Rect &rect) {
+	if (_fullRedraw)
+		return;
+
+	Common::Rect dirtyRect = rect;
+	dirtyRect.clip(Common::Rect(_screen->getDisplayWidth(), _screen->getDisplayHeight()));
+	if (dirtyRect.isEmpty())
+		return;
+
+	// Merge with any overlapping rects, so that nothing gets copied twice
+	for (uint i = 0; i < _dirtyRects.size();) {
+		if (_dirtyRects[i].intersects(dirtyRect)) {
+			dirtyRect.extend(_dirtyRects[i]);
+			_dirtyRects.remove_at(i);
+			i = 0;
+		} else {
+			i++;
+		}
+	}
+
+	// Past a certain amount of rects, it's cheaper to just copy everything
+	if (_dirtyRects.size() >= kMaxDirtyRects)
+		_fullRedraw = true;
+	else
+		_dirtyRects.push_back(dirtyRect);
+}
+
+void GfxFrameout::addDirtyPlane(reg_t planeObject) {
+	if (planeObject.isNull()) {
+		_fullRedraw = true;
+		return;
+	}
+
+	for (PlaneList::iterator it = _planes.begin(); it != _planes.end(); ++it) {
+		if (it->object == planeObject) {
+			if (it->drawn.visible)
+				addDirtyRect(it->drawn.rect);
+			addDirtyRect(it->upscaledPlaneRect);
+			return;
+		}
+	}
+}
+
+void GfxFrameout::copyDirtyRectsToScreen() {
+	if (_fullRedraw) {
+		_screen->copyToScreen();
+	} else {
+		for (uint i = 0; i < _dirtyRects.size(); i++) {
+			if (_screen->getUpscaledHires())
+				_screen->copyDisplayRectToScreen(_dirtyRects[i]);
+			else
+				_screen->copyRectToScreen(_dirtyRects[i]);
+		}
+	}
+
+	_dirtyRects.clear();
+	_fullRedraw = false;
+}
+
 void GfxFrameout::kernelFrameout() {
 	if (g_sci->_robotDecoder->isVideoLoaded()) {
 		showVideo();
+		invalidateScreen();
 		return;
 	}
 
+	// Palette changes (including palVary) are passed on to the backend by
+	// GfxPalette directly, so they never require the screen to be redrawn
 	_palette->palVaryUpdate();
 
-	for (PlaneList::iterator it = _planes.begin(); it != _planes.end(); it++) {
-		reg_t planeObject = it->object;
+	// First, place all screen items and find out what has changed on screen
+	// since the last frame. Planes and screen items keep the state they were
+	// drawn with, so that both their old and new areas get updated.
+	Common::Array<FrameoutList> itemLists;
+	Common::Array<bool> clearPlanes;
+	itemLists.resize(_planes.size());
+	clearPlanes.resize(_planes.size());
 
-		// Draw any plane lines, if they exist
-		// These are drawn on invisible planes as well. (e.g. "invisiblePlane" in LSL6 hires)
-		// FIXME: Lines aren't always drawn (e.g. when the narrator speaks in LSL6 hires).
-		// Perhaps something is painted over them?
-		for (PlaneLineList::iterator it2 = it->lines.begin(); it2 != it->lines.end(); ++it2) {
-			Common::Point startPoint = it2->startPoint;
-			Common::Point endPoint = it2->endPoint;
-			_coordAdjuster->kernelLocalToGlobal(startPoint.x, startPoint.y, it->object);
-			_coordAdjuster->kernelLocalToGlobal(endPoint.x, endPoint.y, it->object);
-			_screen->drawLine(startPoint, endPoint, it2->color, it2->priority, it2->control);
-		}
+	for (FrameoutList::iterator listIterator = _screenItems.begin(); listIterator != _screenItems.end(); listIterator++)
+		(*listIterator)->placed = false;
+
+	uint planeNr = 0;
+	for (PlaneList::iterator it = _planes.begin(); it != _planes.end(); it++, planeNr++) {
+		reg_t planeObject = it->object;
 
 		int16 planeLastPriority = it->lastPriority;
 
@@ -672,21 +938,30 @@ void GfxFrameout::kernelFrameout() {
 		int16 planePriority = it->priority = readSelectorValue(_segMan, planeObject, SELECTOR(priority));
 
 		it->lastPriority = planePriority;
+
+		PlaneDrawState planeState;
+		planeState.visible = planePriority >= 0;
+		planeState.priority = planePriority;
+		planeState.offsetX = it->planeOffsetX;
+		planeState.offsetY = it->planeOffsetY;
+		planeState.pictureId = it->pictureId;
+		planeState.mirrored = it->planePictureMirrored;
+		planeState.back = it->planeBack;
+		planeState.rect = it->upscaledPlaneRect;
+
+		if (planeState != it->drawn) {
+			if (it->drawn.visible)
+				addDirtyRect(it->drawn.rect);
+			addDirtyRect(planeState.rect);
+			it->drawn = planeState;
+		}
+
 		if (planePriority < 0) { // Plane currently not meant to be shown
 			// If plane was shown before, delete plane rect
-			if (planePriority != planeLastPriority)
-				_paint32->fillRect(it->planeRect, 0);
+			clearPlanes[planeNr] = (planePriority != planeLastPriority);
 			continue;
 		}
 
-		// There is a race condition lurking in SQ6, which causes the game to hang in the intro, when teleporting to Polysorbate LX.
-		// Since I first wrote the patch, the race has stopped occurring for me though.
-		// I'll leave this for investigation later, when someone can reproduce.
-		//if (it->pictureId == kPlanePlainColored)	// FIXME: This is what SSCI does, and fixes the intro of LSL7, but breaks the dialogs in GK1 (adds black boxes)
-		if (it->pictureId == kPlanePlainColored && (it->planeBack || g_sci->getGameId() != GID_GK1))
-			_paint32->fillRect(it->planeRect, it->planeBack);
-
-		_coordAdjuster->pictureSetDisplayArea(it->planeRect);
 		// Invoking drewPicture() with an invalid picture ID in SCI32 results in
 		// invalidating the palVary palette when a palVary effect is active. This
 		// is quite obvious in QFG4, where the day time palette is incorrectly
@@ -695,143 +970,95 @@ void GfxFrameout::kernelFrameout() {
 		if (it->pictureId != 0xFFFF)
 			_palette->drewPicture(it->pictureId);
 
-		FrameoutList itemList;
-
-		createPlaneItemList(planeObject, itemList);
+		createPlaneItemList(planeObject, itemLists[planeNr]);
 
-		for (FrameoutList::iterator listIterator = itemList.begin(); listIterator != itemList.end(); listIterator++) {
+		for (FrameoutList::iterator listIterator = itemLists[planeNr].begin(); listIterator != itemLists[planeNr].end(); listIterator++) {
 			FrameoutEntry *itemEntry = *listIterator;
 
-			if (!itemEntry->visible)
+			if (itemEntry->object.isNull() || !itemEntry->visible)
 				continue;
 
-			if (itemEntry->object.isNull()) {
-				// Picture cel data
-				_coordAdjuster->fromScriptToDisplay(itemEntry->y, itemEntry->x);
-				_coordAdjuster->fromScriptToDisplay(itemEntry->picStartY, itemEntry->picStartX);
+			itemEntry->placed = placeScreenItem(itemEntry, *it);
+			if (itemEntry->placed)
+				updateDrawState(itemEntry, &(*it));
+		}
+	}
 
-				if (!isPictureOutOfView(itemEntry, it->planeRect, it->planeOffsetX, it->planeOffsetY))
-					drawPicture(itemEntry, it->planeOffsetX, it->planeOffsetY, it->planePictureMirrored);
-			} else {
-				GfxView *view = (itemEntry->viewId != 0xFFFF) ? _cache->getView(itemEntry->viewId) : NULL;
-				int16 dummyX = 0;
+	// Screen items that aren't shown anymore need to be removed from the screen
+	for (FrameoutList::iterator listIterator = _screenItems.begin(); listIterator != _screenItems.end(); listIterator++) {
+		if (!(*listIterator)->placed)
+			updateDrawState(*listIterator, NULL);
+	}
 
-				if (view && view->isSci2Hires()) {
-					view->adjustToUpscaledCoordinates(itemEntry->y, itemEntry->x);
-					view->adjustToUpscaledCoordinates(itemEntry->z, dummyX);
-				} else if (getSciVersion() >= SCI_VERSION_2_1) {
-					_coordAdjuster->fromScriptToDisplay(itemEntry->y, itemEntry->x);
-					_coordAdjuster->fromScriptToDisplay(itemEntry->z, dummyX);
-				}
+	reg_t scrollText = NULL_REG;
+	if (_showScrollText && _curScrollText >= 0 && _curScrollText < (int16)_scrollTexts.size())
+		scrollText = _scrollTexts[_curScrollText].bitmapHandle;
+	if (scrollText != _drawnScrollText) {
+		_drawnScrollText = scrollText;
+		invalidateScreen();
+	}
 
-				// Adjust according to current scroll position
-				itemEntry->x -= it->planeOffsetX;
-				itemEntry->y -= it->planeOffsetY;
-
-				uint16 useInsetRect = readSelectorValue(_segMan, itemEntry->object, SELECTOR(useInsetRect));
-				if (useInsetRect) {
-					itemEntry->celRect.top = readSelectorValue(_segMan, itemEntry->object, SELECTOR(inTop));
-					itemEntry->celRect.left = readSelectorValue(_segMan, itemEntry->object, SELECTOR(inLeft));
-					itemEntry->celRect.bottom = readSelectorValue(_segMan, itemEntry->object, SELECTOR(inBottom));
-					itemEntry->celRect.right = readSelectorValue(_segMan, itemEntry->object, SELECTOR(inRight));
-					if (view && view->isSci2Hires()) {
-						view->adjustToUpscaledCoordinates(itemEntry->celRect.top, itemEntry->celRect.left);
-						view->adjustToUpscaledCoordinates(itemEntry->celRect.bottom, itemEntry->celRect.right);
-					}
-					itemEntry->celRect.translate(itemEntry->x, itemEntry->y);
-					// TODO: maybe we should clip the cels rect with this, i'm not sure
-					//  the only currently known usage is game menu of gk1
-				} else if (view) {
-					// Process global scaling, if needed.
-					// TODO: Seems like SCI32 always processes global scaling for scaled objects
-					// TODO: We can only process symmetrical scaling for now (i.e. same value for scaleX/scaleY)
-					if ((itemEntry->scaleSignal & kScaleSignalDoScaling32) && 
-					   !(itemEntry->scaleSignal & kScaleSignalDisableGlobalScaling32) &&
-					    (itemEntry->scaleX == itemEntry->scaleY))
-						applyGlobalScaling(itemEntry, it->planeRect, view->getHeight(itemEntry->loopNo, itemEntry->celNo));
-
-					if ((itemEntry->scaleX == 128) && (itemEntry->scaleY == 128))
-						view->getCelRect(itemEntry->loopNo, itemEntry->celNo,
-							itemEntry->x, itemEntry->y, itemEntry->z, itemEntry->celRect);
-					else
-						view->getCelScaledRect(itemEntry->loopNo, itemEntry->celNo,
-							itemEntry->x, itemEntry->y, itemEntry->z, itemEntry->scaleX,
-							itemEntry->scaleY, itemEntry->celRect);
-
-					Common::Rect nsRect = itemEntry->celRect;
-					// Translate back to actual coordinate within scrollable plane
-					nsRect.translate(it->planeOffsetX, it->planeOffsetY);
-
-					if (g_sci->getGameId() == GID_PHANTASMAGORIA2) {
-						// HACK: Some (?) objects in Phantasmagoria 2 have no NS rect. Skip them for now.
-						// TODO: Remove once we figure out how Phantasmagoria 2 draws objects on screen.
-						if (lookupSelector(_segMan, itemEntry->object, SELECTOR(nsLeft), NULL, NULL) != kSelectorVariable)
-							continue;
-					}
-
-					if (view && view->isSci2Hires()) {
-						view->adjustBackUpscaledCoordinates(nsRect.top, nsRect.left);
-						view->adjustBackUpscaledCoordinates(nsRect.bottom, nsRect.right);
-						g_sci->_gfxCompare->setNSRect(itemEntry->object, nsRect);
-					} else if (getSciVersion() >= SCI_VERSION_2_1 && _resMan->detectHires()) {
-						_coordAdjuster->fromDisplayToScript(nsRect.top, nsRect.left);
-						_coordAdjuster->fromDisplayToScript(nsRect.bottom, nsRect.right);
-						g_sci->_gfxCompare->setNSRect(itemEntry->object, nsRect);
-					}
-				}
+	// Now redraw the screen, if anything has changed. Cels aren't clipped
+	// against the damaged areas, so the whole frame gets composed again, but
+	// only the damaged areas are copied to the screen.
+	if (_fullRedraw || !_dirtyRects.empty()) {
+		planeNr = 0;
+		for (PlaneList::iterator it = _planes.begin(); it != _planes.end(); it++, planeNr++) {
+			// Draw any plane lines, if they exist
+			// These are drawn on invisible planes as well. (e.g. "invisiblePlane" in LSL6 hires)
+			// FIXME: Lines aren't always drawn (e.g. when the narrator speaks in LSL6 hires).
+			// Perhaps something is painted over them?
+			for (PlaneLineList::iterator it2 = it->lines.begin(); it2 != it->lines.end(); ++it2) {
+				Common::Point startPoint = it2->startPoint;
+				Common::Point endPoint = it2->endPoint;
+				_coordAdjuster->kernelLocalToGlobal(startPoint.x, startPoint.y, it->object);
+				_coordAdjuster->kernelLocalToGlobal(endPoint.x, endPoint.y, it->object);
+				_screen->drawLine(startPoint, endPoint, it2->color, it2->priority, it2->control);
+			}
 
-				// Don't attempt to draw sprites that are outside the visible
-				// screen area. An example is the random people walking in
-				// Jackson Square in GK1.
-				if (itemEntry->celRect.bottom < 0 || itemEntry->celRect.top  >= _screen->getDisplayHeight() ||
-				    itemEntry->celRect.right  < 0 || itemEntry->celRect.left >= _screen->getDisplayWidth())
-					continue;
+			if (it->priority < 0) {
+				if (clearPlanes[planeNr])
+					_paint32->fillRect(it->planeRect, 0);
+				continue;
+			}
 
-				Common::Rect clipRect, translatedClipRect;
-				clipRect = itemEntry->celRect;
-
-				if (view && view->isSci2Hires()) {
-					clipRect.clip(it->upscaledPlaneClipRect);
-					translatedClipRect = clipRect;
-					translatedClipRect.translate(it->upscaledPlaneRect.left, it->upscaledPlaneRect.top);
-				} else {
-					// QFG4 passes invalid rectangles when a battle is starting
-					if (!clipRect.isValidRect())
-						continue;
-					clipRect.clip(it->planeClipRect);
-					translatedClipRect = clipRect;
-					translatedClipRect.translate(it->planeRect.left, it->planeRect.top);
-				}
+			// There is a race condition lurking in SQ6, which causes the game to hang in the intro, when teleporting to Polysorbate LX.
+			// Since I first wrote the patch, the race has stopped occurring for me though.
+			// I'll leave this for investigation later, when someone can reproduce.
+			//if (it->pictureId == kPlanePlainColored)	// FIXME: This is what SSCI does, and fixes the intro of LSL7, but breaks the dialogs in GK1 (adds black boxes)
+			if (it->pictureId == kPlanePlainColored && (it->planeBack || g_sci->getGameId() != GID_GK1))
+				_paint32->fillRect(it->planeRect, it->planeBack);
 
-				if (view) {
-					if (!clipRect.isEmpty()) {
-						if ((itemEntry->scaleX == 128) && (itemEntry->scaleY == 128))
-							view->draw(itemEntry->celRect, clipRect, translatedClipRect,
-								itemEntry->loopNo, itemEntry->celNo, 255, 0, view->isSci2Hires());
-						else
-							view->drawScaled(itemEntry->celRect, clipRect, translatedClipRect,
-								itemEntry->loopNo, itemEntry->celNo, 255, itemEntry->scaleX, itemEntry->scaleY);
-					}
-				}
+			_coordAdjuster->pictureSetDisplayArea(it->planeRect);
+
+			for (FrameoutList::iterator listIterator = itemLists[planeNr].begin(); listIterator != itemLists[planeNr].end(); listIterator++) {
+				FrameoutEntry *itemEntry = *listIterator;
+
+				if (!itemEntry->visible)
+					continue;
+
+				if (itemEntry->object.isNull()) {
+					// Picture cel data
+					_coordAdjuster->fromScriptToDisplay(itemEntry->y, itemEntry->x);
+					_coordAdjuster->fromScriptToDisplay(itemEntry->picStartY, itemEntry->picStartX);
 
-				// Draw text, if it exists
-				if (lookupSelector(_segMan, itemEntry->object, SELECTOR(text), NULL, NULL) == kSelectorVariable) {
-					g_sci->_gfxText32->drawTextBitmap(itemEntry->x, itemEntry->y, it->planeRect, itemEntry->object);
+					if (!isPictureOutOfView(itemEntry, it->planeRect, it->planeOffsetX, it->planeOffsetY))
+						drawPicture(itemEntry, it->planeOffsetX, it->planeOffsetY, it->planePictureMirrored);
+				} else if (itemEntry->placed) {
+					drawScreenItem(itemEntry, *it);
 				}
 			}
 		}
 
-		for (PlanePictureList::iterator pictureIt = _planePictures.begin(); pictureIt != _planePictures.end(); pictureIt++) {
-			if (pictureIt->object == planeObject) {
-				delete[] pictureIt->pictureCels;
-				pictureIt->pictureCels = 0;
-			}
-		}
-	}
+		showCurrentScrollText();
 
-	showCurrentScrollText();
+		copyDirtyRectsToScreen();
+	}
 
-	_screen->copyToScreen();
+	for (PlanePictureList::iterator pictureIt = _planePictures.begin(); pictureIt != _planePictures.end(); pictureIt++) {
+		delete[] pictureIt->pictureCels;
+		pictureIt->pictureCels = 0;
+	}
 
 	g_sci->getEngineState()->_throttleTrigger = true;
 }
@@ -38,6 +38,29 @@ struct PlaneLineEntry {
 
 typedef Common::List<PlaneLineEntry> PlaneLineList;
 
+/**
+ * The parts of a plane that influence its appearance on screen. The rect is
+ * in display coordinates.
+ */
+struct PlaneDrawState {
+	bool visible;
+	int16 priority;
+	int16 offsetX;
+	int16 offsetY;
+	GuiResourceId pictureId;
+	bool mirrored;
+	byte back;
+	Common::Rect rect;
+
+	bool operator==(const PlaneDrawState &other) const {
+		return visible == other.visible && priority == other.priority &&
+			offsetX == other.offsetX && offsetY == other.offsetY &&
+			pictureId == other.pictureId && mirrored == other.mirrored &&
+			back == other.back && rect == other.rect;
+	}
+	bool operator!=(const PlaneDrawState &other) const { return !(*this == other); }
+};
+
 struct PlaneEntry {
 	reg_t object;
 	int16 priority;
@@ -52,10 +75,39 @@ struct PlaneEntry {
 	bool planePictureMirrored;
 	byte planeBack;
 	PlaneLineList lines;
+	// State the plane was drawn with on the last frame
+	PlaneDrawState drawn;
 };
 
 typedef Common::List<PlaneEntry> PlaneList;
 
+/**
+ * The parts of a screen item that influence its appearance on screen. Rects
+ * are in display coordinates.
+ */
+struct FrameoutDrawState {
+	bool visible;
+	reg_t plane;
+	GuiResourceId viewId;
+	int16 loopNo;
+	int16 celNo;
+	int16 priority;
+	int16 scaleX;
+	int16 scaleY;
+	int16 x, y;
+	Common::Rect rect;
+	reg_t textBitmap;
+	uint32 textChecksum;
+
+	bool operator==(const FrameoutDrawState &other) const {
+		return visible == other.visible && plane == other.plane && viewId == other.viewId &&
+			loopNo == other.loopNo && celNo == other.celNo && priority == other.priority &&
+			scaleX == other.scaleX && scaleY == other.scaleY && x == other.x && y == other.y && rect == other.rect &&
+			textBitmap == other.textBitmap && textChecksum == other.textChecksum;
+	}
+	bool operator!=(const FrameoutDrawState &other) const { return !(*this == other); }
+};
+
 struct FrameoutEntry {
 	uint16 givenOrderNr;
 	reg_t object;
@@ -73,6 +125,13 @@ struct FrameoutEntry {
 	int16 picStartX;
 	int16 picStartY;
 	bool visible;
+	// Set up for every frame by placeScreenItem()
+	Common::Rect clipRect;
+	Common::Rect translatedClipRect;
+	bool placed;
+	// State the item was drawn with on the last frame, used to find out
+	// which parts of the screen need to be updated
+	FrameoutDrawState drawn;
 };
 
 typedef Common::List<FrameoutEntry *> FrameoutList;
@@ -151,9 +210,24 @@ public:
 	void printPlaneList(Console *con);
 	void printPlaneItemList(Console *con, reg_t planeObject);
 
+	/**
+	 * Marks the whole screen as changed, so that the next frame is completely
+	 * redrawn. Needs to be called whenever something else than kFrameout
+	 * draws on the screen (e.g. videos).
+	 */
+	void invalidateScreen() { _fullRedraw = true; }
+
 private:
 	void showVideo();
 	void createPlaneItemList(reg_t planeObject, FrameoutList &itemList);
+	bool placeScreenItem(FrameoutEntry *itemEntry, const PlaneEntry &plane);
+	void drawScreenItem(FrameoutEntry *itemEntry, const PlaneEntry &plane);
+	void updateDrawState(FrameoutEntry *itemEntry, const PlaneEntry *plane);
+	uint32 getTextChecksum(reg_t bitmapHandle);
+	Common::Rect toDisplayRect(Common::Rect rect);
+	void addDirtyRect(const Common::Rect &rect);
+	void addDirtyPlane(reg_t planeObject);
+	void copyDirtyRectsToScreen();
 	bool isPictureOutOfView(FrameoutEntry *itemEntry, Common::Rect planeRect, int16 planeOffsetX, int16 planeOffsetY);
 	void drawPicture(FrameoutEntry *itemEntry, int16 planeOffsetX, int16 planeOffsetY, bool planePictureMirrored);
 
@@ -172,6 +246,11 @@ private:
 	int16 _curScrollText;
 	bool _showScrollText;
 	uint16 _maxScrollTexts;
+	reg_t _drawnScrollText;
+
+	// Damaged parts of the screen since the last frame, in display coordinates
+	Common::Array<Common::Rect> _dirtyRects;
+	bool _fullRedraw;
 
 	void sortPlanes();
 };
@@ -41,11 +41,16 @@
 
 namespace Sci {
 
+enum {
+	MAX_CACHED_PICTURES = 4
+};
+
 GfxPaint16::GfxPaint16(ResourceManager *resMan, SegManager *segMan, Kernel *kernel, GfxCache *cache, GfxPorts *ports, GfxCoordAdjuster *coordAdjuster, GfxScreen *screen, GfxPalette *palette, GfxTransitions *transitions, AudioPlayer *audio)
 	: _resMan(resMan), _segMan(segMan), _kernel(kernel), _cache(cache), _ports(ports), _coordAdjuster(coordAdjuster), _screen(screen), _palette(palette), _transitions(transitions), _audio(audio) {
 }
 
 GfxPaint16::~GfxPaint16() {
+	purgePictureCache();
 }
 
 void GfxPaint16::init(GfxAnimate *animate, GfxText16 *text16) {
@@ -61,12 +66,26 @@ void GfxPaint16::debugSetEGAdrawingVisualize(bool state) {
 
 void GfxPaint16::drawPicture(GuiResourceId pictureId, int16 animationNr, bool mirroredFlag, bool addToFlag, GuiResourceId paletteId) {
 	GfxPicture *picture = new GfxPicture(_resMan, _coordAdjuster, _ports, _screen, _palette, pictureId, _EGAdrawingVisualize);
+	Common::Rect cacheRect;
 
 	// do we add to a picture? if not -> clear screen with white
 	if (!addToFlag)
 		clearScreen(_screen->getColorWhite());
 
-	picture->draw(animationNr, mirroredFlag, addToFlag, paletteId);
+	if (isPictureCacheable(picture, addToFlag, cacheRect)) {
+		PictureCacheEntry *cachedPicture = getCachedPicture(pictureId, mirroredFlag, paletteId, cacheRect);
+		if (cachedPicture) {
+			// We got the pixels already, the picture only needs to set palette
+			//  and priority bands again
+			_screen->bitsRestore(cachedPicture->bits);
+			picture->draw(animationNr, mirroredFlag, addToFlag, paletteId, true);
+		} else {
+			picture->draw(animationNr, mirroredFlag, addToFlag, paletteId);
+			addCachedPicture(pictureId, mirroredFlag, paletteId, cacheRect);
+		}
+	} else {
+		picture->draw(animationNr, mirroredFlag, addToFlag, paletteId);
+	}
 	delete picture;
 
 	// We make a call to SciPalette here, for increasing sys timestamp and also loading targetpalette, if palvary active
@@ -75,6 +94,62 @@ void GfxPaint16::drawPicture(GuiResourceId pictureId, int16 animationNr, bool mi
 		_palette->drewPicture(pictureId);
 }
 
+/**
+ * Only vector pictures, that get drawn onto a freshly cleared port, are cached.
+ *  The port area, that got cleared, is returned inside rect. It also needs to be
+ *  the area that the picture may draw into. Undithering is excluded, because
+ *  dithering then also remembers the dithered colors for cel undithering.
+ */
+bool GfxPaint16::isPictureCacheable(GfxPicture *picture, bool addToFlag, Common::Rect &rect) {
+	if (addToFlag || _EGAdrawingVisualize || _screen->isUnditheringEnabled())
+		return false;
+	if (!picture->isVectorPicture())
+		return false;
+
+	rect = _ports->_curPort->rect;
+	_ports->offsetRect(rect);
+	if (rect != _coordAdjuster->pictureGetDisplayArea())
+		return false;
+	rect.clip(Common::Rect(_screen->getWidth(), _screen->getHeight()));
+	return !rect.isEmpty();
+}
+
+PictureCacheEntry *GfxPaint16::getCachedPicture(GuiResourceId pictureId, bool mirroredFlag, int16 EGApaletteNo, const Common::Rect &rect) {
+	for (PictureCacheList::iterator it = _cachedPictures.begin(); it != _cachedPictures.end(); ++it) {
+		if (it->pictureId == pictureId && it->mirroredFlag == mirroredFlag && it->EGApaletteNo == EGApaletteNo && it->rect == rect) {
+			// Move it to the front, so that it gets purged last
+			if (it != _cachedPictures.begin()) {
+				_cachedPictures.push_front(*it);
+				_cachedPictures.erase(it);
+			}
+			return &_cachedPictures.front();
+		}
+	}
+	return NULL;
+}
+
+void GfxPaint16::addCachedPicture(GuiResourceId pictureId, bool mirroredFlag, int16 EGApaletteNo, const Common::Rect &rect) {
+	if (_cachedPictures.size() >= MAX_CACHED_PICTURES) {
+		delete[] _cachedPictures.back().bits;
+		_cachedPictures.pop_back();
+	}
+
+	PictureCacheEntry entry;
+	entry.pictureId = pictureId;
+	entry.mirroredFlag = mirroredFlag;
+	entry.EGApaletteNo = EGApaletteNo;
+	entry.rect = rect;
+	entry.bits = new byte[_screen->bitsGetDataSize(rect, GFX_SCREEN_MASK_ALL)];
+	_screen->bitsSave(rect, GFX_SCREEN_MASK_ALL, entry.bits);
+	_cachedPictures.push_front(entry);
+}
+
+void GfxPaint16::purgePictureCache() {
+	for (PictureCacheList::iterator it = _cachedPictures.begin(); it != _cachedPictures.end(); ++it)
+		delete[] it->bits;
+	_cachedPictures.clear();
+}
+
 // This one is the only one that updates screen!
 void GfxPaint16::drawCelAndShow(GuiResourceId viewId, int16 loopNo, int16 celNo, uint16 leftPos, uint16 topPos, byte priority, uint16 paletteNo, uint16 scaleX, uint16 scaleY) {
 	GfxView *view = _cache->getView(viewId);
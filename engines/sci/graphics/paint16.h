@@ -23,6 +23,8 @@
 #ifndef SCI_GRAPHICS_PAINT16_H
 #define SCI_GRAPHICS_PAINT16_H
 
+#include "common/list.h"
+
 #include "sci/graphics/paint.h"
 
 namespace Sci {
@@ -32,6 +34,23 @@ class GfxScreen;
 class GfxPalette;
 class Font;
 class GfxView;
+class GfxPicture;
+
+/**
+ * Screen contents of a vector picture that got drawn onto a cleared port. Vector
+ *  pictures are built by replaying all of their drawing operations and flood
+ *  fills, which makes them expensive to draw, but the result only depends on
+ *  the values used as the key.
+ */
+struct PictureCacheEntry {
+	GuiResourceId pictureId;
+	bool mirroredFlag;
+	int16 EGApaletteNo;
+	Common::Rect rect;
+	byte *bits;
+};
+
+typedef Common::List<PictureCacheEntry> PictureCacheList;
 
 /**
  * Paint16 class, handles painting/drawing for SCI16 (SCI0-SCI1.1) games
@@ -87,6 +106,11 @@ public:
 	void kernelPortraitUnload(uint16 portraitId);
 
 private:
+	bool isPictureCacheable(GfxPicture *picture, bool addToFlag, Common::Rect &rect);
+	PictureCacheEntry *getCachedPicture(GuiResourceId pictureId, bool mirroredFlag, int16 EGApaletteNo, const Common::Rect &rect);
+	void addCachedPicture(GuiResourceId pictureId, bool mirroredFlag, int16 EGApaletteNo, const Common::Rect &rect);
+	void purgePictureCache();
+
 	ResourceManager *_resMan;
 	SegManager *_segMan;
 	Kernel *_kernel;
@@ -102,6 +126,9 @@ private:
 
 	// true means make EGA picture drawing visible
 	bool _EGAdrawingVisualize;
+
+	// most recently drawn vector pictures, most recent one first
+	PictureCacheList _cachedPictures;
 };
 
 } // End of namespace Sci
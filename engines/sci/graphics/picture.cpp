@@ -36,7 +36,7 @@ namespace Sci {
 //#define DEBUG_PICTURE_DRAW
 
 GfxPicture::GfxPicture(ResourceManager *resMan, GfxCoordAdjuster *coordAdjuster, GfxPorts *ports, GfxScreen *screen, GfxPalette *palette, GuiResourceId resourceId, bool EGAdrawingVisualize)
-	: _resMan(resMan), _coordAdjuster(coordAdjuster), _ports(ports), _screen(screen), _palette(palette), _resourceId(resourceId), _EGAdrawingVisualize(EGAdrawingVisualize) {
+	: _resMan(resMan), _coordAdjuster(coordAdjuster), _ports(ports), _screen(screen), _palette(palette), _resourceId(resourceId), _stateOnly(false), _EGAdrawingVisualize(EGAdrawingVisualize) {
 	assert(resourceId != -1);
 	initData(resourceId);
 }
@@ -56,10 +56,22 @@ GuiResourceId GfxPicture::getResourceId() {
 	return _resourceId;
 }
 
+bool GfxPicture::isVectorPicture() {
+	switch (READ_LE_UINT16(_resource->data)) {
+	case 0x26: // SCI 1.1 VGA picture
+#ifdef ENABLE_SCI32
+	case 0x0e: // SCI32 VGA picture
+#endif
+		return false;
+	default:
+		return true;
+	}
+}
+
 // differentiation between various picture formats can NOT get done using sci-version checks.
 //  Games like PQ1 use the "old" vector data picture format, but are actually SCI1.1
 //  We should leave this that way to decide the format on-the-fly instead of hardcoding it in any way
-void GfxPicture::draw(int16 animationNr, bool mirroredFlag, bool addToFlag, int16 EGApaletteNo) {
+void GfxPicture::draw(int16 animationNr, bool mirroredFlag, bool addToFlag, int16 EGApaletteNo, bool stateOnly) {
 	uint16 headerSize;
 
 	_animationNr = animationNr;
@@ -67,6 +79,7 @@ void GfxPicture::draw(int16 animationNr, bool mirroredFlag, bool addToFlag, int1
 	_addToFlag = addToFlag;
 	_EGApaletteNo = EGApaletteNo;
 	_priority = 0;
+	_stateOnly = stateOnly;
 
 	headerSize = READ_LE_UINT16(_resource->data);
 	switch (headerSize) {
@@ -599,7 +612,8 @@ void GfxPicture::drawVectorData(byte *data, int dataSize) {
 				Common::Point startPoint(oldx, oldy);
 				Common::Point endPoint(x, y);
 				_ports->offsetLine(startPoint, endPoint);
-				_screen->drawLine(startPoint, endPoint, pic_color, pic_priority, pic_control);
+				if (!_stateOnly)
+					_screen->drawLine(startPoint, endPoint, pic_color, pic_priority, pic_control);
 			}
 			break;
 		case PIC_OP_MEDIUM_LINES: // medium line
@@ -619,7 +633,8 @@ void GfxPicture::drawVectorData(byte *data, int dataSize) {
 				Common::Point startPoint(oldx, oldy);
 				Common::Point endPoint(x, y);
 				_ports->offsetLine(startPoint, endPoint);
-				_screen->drawLine(startPoint, endPoint, pic_color, pic_priority, pic_control);
+				if (!_stateOnly)
+					_screen->drawLine(startPoint, endPoint, pic_color, pic_priority, pic_control);
 			}
 			break;
 		case PIC_OP_LONG_LINES: // long line
@@ -630,14 +645,16 @@ void GfxPicture::drawVectorData(byte *data, int dataSize) {
 				Common::Point startPoint(oldx, oldy);
 				Common::Point endPoint(x, y);
 				_ports->offsetLine(startPoint, endPoint);
-				_screen->drawLine(startPoint, endPoint, pic_color, pic_priority, pic_control);
+				if (!_stateOnly)
+					_screen->drawLine(startPoint, endPoint, pic_color, pic_priority, pic_control);
 			}
 			break;
 
 		case PIC_OP_FILL: //fill
 			while (vectorIsNonOpcode(data[curPos])) {
 				vectorGetAbsCoords(data, curPos, x, y);
-				vectorFloodFill(x, y, pic_color, pic_priority, pic_control);
+				if (!_stateOnly)
+					vectorFloodFill(x, y, pic_color, pic_priority, pic_control);
 			}
 			break;
 
@@ -670,11 +687,13 @@ void GfxPicture::drawVectorData(byte *data, int dataSize) {
 				error("pic-operation short pattern inside sci1.1+ vector data");
 			vectorGetPatternTexture(data, curPos, pattern_Code, pattern_Texture);
 			vectorGetAbsCoords(data, curPos, x, y);
-			vectorPattern(x, y, pic_color, pic_priority, pic_control, pattern_Code, pattern_Texture);
+			if (!_stateOnly)
+				vectorPattern(x, y, pic_color, pic_priority, pic_control, pattern_Code, pattern_Texture);
 			while (vectorIsNonOpcode(data[curPos])) {
 				vectorGetPatternTexture(data, curPos, pattern_Code, pattern_Texture);
 				vectorGetRelCoords(data, curPos, x, y);
-				vectorPattern(x, y, pic_color, pic_priority, pic_control, pattern_Code, pattern_Texture);
+				if (!_stateOnly)
+					vectorPattern(x, y, pic_color, pic_priority, pic_control, pattern_Code, pattern_Texture);
 			}
 			break;
 		case PIC_OP_MEDIUM_PATTERNS:
@@ -682,11 +701,13 @@ void GfxPicture::drawVectorData(byte *data, int dataSize) {
 				error("pic-operation medium pattern inside sci1.1+ vector data");
 			vectorGetPatternTexture(data, curPos, pattern_Code, pattern_Texture);
 			vectorGetAbsCoords(data, curPos, x, y);
-			vectorPattern(x, y, pic_color, pic_priority, pic_control, pattern_Code, pattern_Texture);
+			if (!_stateOnly)
+				vectorPattern(x, y, pic_color, pic_priority, pic_control, pattern_Code, pattern_Texture);
 			while (vectorIsNonOpcode(data[curPos])) {
 				vectorGetPatternTexture(data, curPos, pattern_Code, pattern_Texture);
 				vectorGetRelCoordsMed(data, curPos, x, y);
-				vectorPattern(x, y, pic_color, pic_priority, pic_control, pattern_Code, pattern_Texture);
+				if (!_stateOnly)
+					vectorPattern(x, y, pic_color, pic_priority, pic_control, pattern_Code, pattern_Texture);
 			}
 			break;
 		case PIC_OP_ABSOLUTE_PATTERN:
@@ -695,7 +716,8 @@ void GfxPicture::drawVectorData(byte *data, int dataSize) {
 			while (vectorIsNonOpcode(data[curPos])) {
 				vectorGetPatternTexture(data, curPos, pattern_Code, pattern_Texture);
 				vectorGetAbsCoords(data, curPos, x, y);
-				vectorPattern(x, y, pic_color, pic_priority, pic_control, pattern_Code, pattern_Texture);
+				if (!_stateOnly)
+					vectorPattern(x, y, pic_color, pic_priority, pic_control, pattern_Code, pattern_Texture);
 			}
 			break;
 
@@ -738,7 +760,8 @@ void GfxPicture::drawVectorData(byte *data, int dataSize) {
 					vectorGetAbsCoordsNoMirror(data, curPos, x, y);
 					size = READ_LE_UINT16(data + curPos); curPos += 2;
 					_priority = pic_priority; // set global priority so the cel gets drawn using current priority as well
-					drawCelData(data, _resource->size, curPos, curPos + 8, 0, x, y, 0, 0);
+					if (!_stateOnly)
+						drawCelData(data, _resource->size, curPos, curPos + 8, 0, x, y, 0, 0);
 					curPos += size;
 					break;
 				case PIC_OPX_EGA_SET_PRIORITY_TABLE:
@@ -781,7 +804,8 @@ void GfxPicture::drawVectorData(byte *data, int dataSize) {
 					vectorGetAbsCoordsNoMirror(data, curPos, x, y);
 					size = READ_LE_UINT16(data + curPos); curPos += 2;
 					_priority = pic_priority; // set global priority so the cel gets drawn using current priority as well
-					drawCelData(data, _resource->size, curPos, curPos + 8, 0, x, y, 0, 0);
+					if (!_stateOnly)
+						drawCelData(data, _resource->size, curPos, curPos + 8, 0, x, y, 0, 0);
 					curPos += size;
 					break;
 				case PIC_OPX_VGA_PRIORITY_TABLE_EQDIST:
@@ -800,7 +824,7 @@ void GfxPicture::drawVectorData(byte *data, int dataSize) {
 		case PIC_OP_TERMINATE:
 			_priority = pic_priority;
 			// Dithering EGA pictures
-			if (isEGA) {
+			if (isEGA && !_stateOnly) {
 				_screen->dither(_addToFlag);
 				switch (g_sci->getGameId()) {
 				case GID_SQ3:
@@ -820,7 +844,7 @@ void GfxPicture::drawVectorData(byte *data, int dataSize) {
 		default:
 			error("Unsupported pic-operation %X", pic_op);
 		}
-		if ((_EGAdrawingVisualize) && (isEGA)) {
+		if ((_EGAdrawingVisualize) && (isEGA) && (!_stateOnly)) {
 			_screen->copyToScreen();
 			g_system->updateScreen();
 			g_system->delayMillis(10);
@@ -890,7 +914,7 @@ void GfxPicture::vectorFloodFill(int16 x, int16 y, byte color, byte priority, by
 	Common::Stack<Common::Point> stack;
 	Common::Point p, p1;
 	byte screenMask = _screen->getDrawingMask(color, priority, control);
-	byte matchedMask, matchMask;
+	byte matchMask;
 	int16 w, e, a_set, b_set;
 
 	bool isEGA = (_resMan->getViewType() == kViewEga);
@@ -952,41 +976,36 @@ void GfxPicture::vectorFloodFill(int16 x, int16 y, byte color, byte priority, by
 	int t = curPort->rect.top + curPort->top;
 	int r = curPort->rect.right + curPort->left - 1;
 	int b = curPort->rect.bottom + curPort->top - 1;
+	// The span scans below walk the screen buffers directly, but they still
+	//  fill and push exactly the same points in the same order as sierra did
+	//  with its pixel-by-pixel loops.
 	while (stack.size()) {
 		p = stack.pop();
-		if ((matchedMask = _screen->isFillMatch(p.x, p.y, matchMask, searchColor, searchPriority, searchControl, isEGA)) == 0) // already filled
+		if (_screen->isFillMatch(p.x, p.y, matchMask, searchColor, searchPriority, searchControl, isEGA) == 0) // already filled
 			continue;
-		_screen->putPixel(p.x, p.y, screenMask, color, priority, control);
-		w = p.x;
-		e = p.x;
 		// moving west and east pointers as long as there is a matching color to fill
-		while (w > l && (matchedMask = _screen->isFillMatch(w - 1, p.y, matchMask, searchColor, searchPriority, searchControl, isEGA)))
-			_screen->putPixel(--w, p.y, screenMask, color, priority, control);
-		while (e < r && (matchedMask = _screen->isFillMatch(e + 1, p.y, matchMask, searchColor, searchPriority, searchControl, isEGA)))
-			_screen->putPixel(++e, p.y, screenMask, color, priority, control);
-		// checking lines above and below for possible flood targets
-		a_set = b_set = 0;
-		while (w <= e) {
-			if (p.y > t && (matchedMask = _screen->isFillMatch(w, p.y - 1, matchMask, searchColor, searchPriority, searchControl, isEGA))) { // one line above
-				if (a_set == 0) {
-					p1.x = w;
-					p1.y = p.y - 1;
-					stack.push(p1);
-					a_set = 1;
-				}
-			} else
-				a_set = 0;
-
-			if (p.y < b && (matchedMask = _screen->isFillMatch(w, p.y + 1, matchMask, searchColor, searchPriority, searchControl, isEGA))) { // one line below
-				if (b_set == 0) {
-					p1.x = w;
-					p1.y = p.y + 1;
-					stack.push(p1);
-					b_set = 1;
-				}
-			} else
-				b_set = 0;
-			w++;
+		w = _screen->scanFillMatch(p.x - 1, p.y, -1, l, true, matchMask, searchColor, searchPriority, searchControl, isEGA) + 1;
+		e = _screen->scanFillMatch(p.x + 1, p.y, 1, r, true, matchMask, searchColor, searchPriority, searchControl, isEGA) - 1;
+		_screen->putPixelSpan(w, e, p.y, screenMask, color, priority, control);
+		// checking lines above and below for possible flood targets, every
+		//  run of matching pixels gets its first pixel pushed. Runs above
+		//  get pushed before runs below, that start at the same x
+		a_set = (p.y > t) ? _screen->scanFillMatch(w, p.y - 1, 1, e, false, matchMask, searchColor, searchPriority, searchControl, isEGA) : e + 1;
+		b_set = (p.y < b) ? _screen->scanFillMatch(w, p.y + 1, 1, e, false, matchMask, searchColor, searchPriority, searchControl, isEGA) : e + 1;
+		while (a_set <= e || b_set <= e) {
+			if (a_set <= b_set) {
+				p1.x = a_set;
+				p1.y = p.y - 1;
+				stack.push(p1);
+				a_set = _screen->scanFillMatch(a_set + 1, p1.y, 1, e, true, matchMask, searchColor, searchPriority, searchControl, isEGA);
+				a_set = _screen->scanFillMatch(a_set, p1.y, 1, e, false, matchMask, searchColor, searchPriority, searchControl, isEGA);
+			} else {
+				p1.x = b_set;
+				p1.y = p.y + 1;
+				stack.push(p1);
+				b_set = _screen->scanFillMatch(b_set + 1, p1.y, 1, e, true, matchMask, searchColor, searchPriority, searchControl, isEGA);
+				b_set = _screen->scanFillMatch(b_set, p1.y, 1, e, false, matchMask, searchColor, searchPriority, searchControl, isEGA);
+			}
 		}
 	}
 }
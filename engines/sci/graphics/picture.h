@@ -49,7 +49,8 @@ public:
 	~GfxPicture();
 
 	GuiResourceId getResourceId();
-	void draw(int16 animationNr, bool mirroredFlag, bool addToFlag, int16 EGApaletteNo);
+	bool isVectorPicture();
+	void draw(int16 animationNr, bool mirroredFlag, bool addToFlag, int16 EGApaletteNo, bool stateOnly = false);
 
 #ifdef ENABLE_SCI32
 	int16 getSci32celCount();
@@ -96,6 +97,10 @@ private:
 	int16 _EGApaletteNo;
 	byte _priority;
 
+	// If true, only palette and priority band changes get applied, but nothing
+	//  gets drawn. Used when the pixels of the picture got restored from cache
+	bool _stateOnly;
+
 	// If true, we will show the whole EGA drawing process...
 	bool _EGAdrawingVisualize;
 };
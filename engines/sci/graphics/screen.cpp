@@ -242,6 +242,34 @@ void GfxScreen::putPixel(int x, int y, byte drawMask, byte color, byte priority,
 		_controlScreen[offset] = control;
 }
 
+/**
+ * Draws the pixels from left to right (inclusive) on one line, used by the
+ *  picture flood fill. Behaves exactly like calling putPixel() for each pixel.
+ */
+void GfxScreen::putPixelSpan(int16 left, int16 right, int16 y, byte drawMask, byte color, byte priority, byte control) {
+	int offset = y * _pitch + left;
+	int width = right - left + 1;
+
+	if (drawMask & GFX_SCREEN_MASK_VISUAL) {
+		memset(_visualScreen + offset, color, width);
+		if (!_upscaledHires) {
+			memset(_displayScreen + offset, color, width);
+		} else {
+			int displayOffset = _upscaledMapping[y] * _displayWidth + left * 2;
+			int heightOffsetBreak = (_upscaledMapping[y + 1] - _upscaledMapping[y]) * _displayWidth;
+			int heightOffset = 0;
+			do {
+				memset(_displayScreen + displayOffset + heightOffset, color, width * 2);
+				heightOffset += _displayWidth;
+			} while (heightOffset != heightOffsetBreak);
+		}
+	}
+	if (drawMask & GFX_SCREEN_MASK_PRIORITY)
+		memset(_priorityScreen + offset, priority, width);
+	if (drawMask & GFX_SCREEN_MASK_CONTROL)
+		memset(_controlScreen + offset, control, width);
+}
+
 /**
  * This is used to put font pixels onto the screen - we adjust differently, so that we won't
  *  do triple pixel lines in any case on upscaled hires. That way the font will not get distorted
@@ -395,6 +423,48 @@ byte GfxScreen::isFillMatch(int16 x, int16 y, byte screenMask, byte t_color, byt
 	return match;
 }
 
+/**
+ * Walks from x in steps of step (1 or -1) up to limit (inclusive) on one line,
+ *  as long as isFillMatch() for the pixels returns "matching". Returns the
+ *  first x that stopped the walk or limit + step, if every pixel got walked
+ *  (or x itself, if it already is beyond limit).
+ *  Like in the flood fill itself, only one screen of screenMask is compared.
+ */
+int16 GfxScreen::scanFillMatch(int16 x, int16 y, int16 step, int16 limit, bool matching, byte screenMask, byte t_color, byte t_pri, byte t_con, bool isEGA) {
+	const byte *line;
+	byte target;
+
+	if (screenMask & GFX_SCREEN_MASK_VISUAL) {
+		line = _visualScreen;
+		target = t_color;
+	} else if (screenMask & GFX_SCREEN_MASK_PRIORITY) {
+		line = _priorityScreen;
+		target = t_pri;
+	} else {
+		line = _controlScreen;
+		target = t_con;
+	}
+	line += y * _pitch;
+
+	if (isEGA && (screenMask & GFX_SCREEN_MASK_VISUAL)) {
+		// Compare the visible color of the pixel only, see isFillMatch()
+		while ((step > 0) ? (x <= limit) : (x >= limit)) {
+			byte c = line[x];
+			if ((x ^ y) & 1)
+				c = (c ^ (c >> 4)) & 0x0F;
+			else
+				c = c & 0x0F;
+			if ((c == target) != matching)
+				break;
+			x += step;
+		}
+	} else {
+		while (((step > 0) ? (x <= limit) : (x >= limit)) && (line[x] == target) == matching)
+			x += step;
+	}
+	return x;
+}
+
 int GfxScreen::bitsGetDataSize(Common::Rect rect, byte mask) {
 	int byteCount = sizeof(rect) + sizeof(mask);
 	int pixels = rect.width() * rect.height();
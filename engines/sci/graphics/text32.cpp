@@ -36,8 +36,6 @@
 
 namespace Sci {
 
-#define BITMAP_HEADER_SIZE 46
-
 #define SCI_TEXT32_ALIGNMENT_RIGHT -1
 #define SCI_TEXT32_ALIGNMENT_CENTER 1
 #define SCI_TEXT32_ALIGNMENT_LEFT	0
@@ -25,6 +25,8 @@
 
 namespace Sci {
 
+#define BITMAP_HEADER_SIZE 46
+
 /**
  * Text32 class, handles text calculation and displaying of text for SCI2, SCI21 and SCI3 games
  */
@@ -324,6 +324,18 @@ public:
 	 */
 	Common::List<ResourceId> listResources(ResourceType type, int mapNumber = -1);
 
+	/**
+	 * Opens a SCI1.1 audio resource, that is stored inside an uncompressed
+	 * audio volume, as its own stream, without loading the resource itself.
+	 * This is used to stream long speech samples right from the volume.
+	 * @param id			Id of the audio resource
+	 * @param headerSize	Size of the SOL header the stream starts with
+	 * @return				The stream covering the SOL header and the sample
+	 *						data, or NULL if the resource can't be streamed or
+	 *						is already loaded
+	 */
+	Common::SeekableReadStream *getAudioResourceStream(ResourceId id, uint32 &headerSize);
+
 	void setAudioLanguage(int language);
 	int getAudioLanguage() const;
 	void changeAudioDirectory(Common::String path);
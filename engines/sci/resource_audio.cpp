@@ -24,6 +24,7 @@
 
 #include "common/archive.h"
 #include "common/file.h"
+#include "common/substream.h"
 #include "common/textconsole.h"
 
 #include "sci/resource.h"
@@ -891,6 +892,64 @@ void AudioVolumeResourceSource::loadResource(ResourceManager *resMan, Resource *
 		delete fileStream;
 }
 
+Common::SeekableReadStream *ResourceManager::getAudioResourceStream(ResourceId id, uint32 &headerSize) {
+	Resource *res = testResource(id);
+
+	// Resources, that got loaded already, are played from memory
+	if (!res || res->_status != kResStatusNoMalloc)
+		return NULL;
+	if (getSciVersion() < SCI_VERSION_1_1 || res->_source->getSourceType() != kSourceAudioVolume)
+		return NULL;
+	// Compressed volumes don't contain SOL headers
+	if (res->getAudioCompressionType())
+		return NULL;
+
+	// We use our own file handle here, because the volume files inside
+	//  _volumeFiles may get closed at any time
+	Common::SeekableReadStream *fileStream;
+	if (res->_source->_resourceFile) {
+		fileStream = res->_source->_resourceFile->createReadStream();
+	} else {
+		Common::File *file = new Common::File();
+		if (!file->open(res->_source->getLocationName())) {
+			delete file;
+			return NULL;
+		}
+		fileStream = file;
+	}
+	if (!fileStream)
+		return NULL;
+
+	// Same layout as read by loadFromAudioVolumeSCI11(), WAVE files are not
+	//  streamed
+	fileStream->seek(res->_fileOffset, SEEK_SET);
+	if (fileStream->readUint32BE() == MKTAG('R','I','F','F')) {
+		delete fileStream;
+		return NULL;
+	}
+	fileStream->seek(-4, SEEK_CUR);
+
+	uint32 size = res->size;
+	ResourceType type = convertResType(fileStream->readByte());
+	headerSize = fileStream->readByte();
+	if (type != kResourceTypeAudio || (headerSize != 7 && headerSize != 11 && headerSize != 12)) {
+		delete fileStream;
+		return NULL;
+	}
+	if (headerSize != 7) { // Size is defined already from the map
+		fileStream->seek(7, SEEK_CUR);
+		size = fileStream->readUint32LE();
+		fileStream->seek(-11, SEEK_CUR);
+	}
+
+	int32 start = fileStream->pos();
+	if (fileStream->err() || start + headerSize + size > (uint32)fileStream->size()) {
+		delete fileStream;
+		return NULL;
+	}
+	return new Common::SeekableSubReadStream(fileStream, start, start + headerSize + size, DisposeAfterUse::YES);
+}
+
 bool ResourceManager::addAudioSources() {
 	Common::List<ResourceId> resources = listResources(kResourceTypeMap);
 	Common::List<ResourceId>::iterator itr;
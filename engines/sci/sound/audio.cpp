@@ -30,6 +30,7 @@
 
 #include "common/file.h"
 #include "common/memstream.h"
+#include "common/substream.h"
 #include "common/system.h"
 
 #include "audio/audiostream.h"
@@ -241,6 +242,146 @@ static byte *readSOLAudio(Common::SeekableReadStream *audioStream, uint32 &size,
 	return buffer;
 }
 
+/**
+ * Plays SOL audio right from a stream, decompressing the DPCM data while it
+ * is being played. This way the time until the first sample plays doesn't
+ * depend on the length of the audio anymore. Produces exactly the same
+ * samples as playing the buffer of readSOLAudio() through a raw stream.
+ */
+class SOLStream : public Audio::SeekableAudioStream {
+public:
+	SOLStream(Common::SeekableReadStream *stream, uint16 rate, byte audioFlags);
+	~SOLStream();
+
+	int readBuffer(int16 *buffer, const int numSamples);
+	bool isStereo() const { return false; }
+	int getRate() const { return _rate; }
+	bool endOfData() const { return _curSample >= _sampleCount; }
+	bool seek(const Audio::Timestamp &where);
+	Audio::Timestamp getLength() const { return Audio::Timestamp(0, _sampleCount, _rate); }
+
+private:
+	enum {
+		kBufferSize = 4096
+	};
+
+	bool fillBuffer();
+
+	Common::SeekableReadStream *_stream;
+	const uint16 _rate;
+	const byte _audioFlags;
+	const uint16 _unsignedMask;
+	uint32 _sampleCount;
+	uint32 _curSample;
+	int32 _dpcmSample;
+
+	byte _buffer[kBufferSize];
+	uint32 _bufferPos;
+	uint32 _bufferSize;
+};
+
+SOLStream::SOLStream(Common::SeekableReadStream *stream, uint16 rate, byte audioFlags)
+	: _stream(stream), _rate(rate), _audioFlags(audioFlags),
+	  _unsignedMask((audioFlags & kSolFlagIsSigned) ? 0 : 0x8000), _curSample(0),
+	  _bufferPos(0), _bufferSize(0) {
+
+	uint32 size = _stream->size();
+	if (_audioFlags & kSolFlagCompressed)
+		_sampleCount = (_audioFlags & kSolFlag16Bit) ? size : size * 2;
+	else
+		_sampleCount = (_audioFlags & kSolFlag16Bit) ? size / 2 : size;
+	_dpcmSample = (_audioFlags & kSolFlag16Bit) ? 0 : 0x80;
+}
+
+SOLStream::~SOLStream() {
+	delete _stream;
+}
+
+bool SOLStream::fillBuffer() {
+	_bufferPos = 0;
+	_bufferSize = _stream->read(_buffer, kBufferSize);
+	return _bufferSize > 0;
+}
+
+int SOLStream::readBuffer(int16 *buffer, const int numSamples) {
+	int samples = 0;
+
+	while (samples < numSamples && _curSample < _sampleCount) {
+		if (_bufferPos >= _bufferSize && !fillBuffer())
+			break;
+
+		uint16 sample;
+		if (_audioFlags & kSolFlagCompressed) {
+			if (_audioFlags & kSolFlag16Bit) {
+				byte b = _buffer[_bufferPos++];
+				if (b & 0x80)
+					_dpcmSample -= tableDPCM16[b & 0x7f];
+				else
+					_dpcmSample += tableDPCM16[b];
+				_dpcmSample = CLIP<int32>(_dpcmSample, -32768, 32767);
+				sample = (uint16)_dpcmSample;
+			} else {
+				// Every byte contains two samples, high nibble first
+				byte out;
+				if (_curSample & 1)
+					deDPCM8Nibble(&out, _dpcmSample, _buffer[_bufferPos++] & 0xf);
+				else
+					deDPCM8Nibble(&out, _dpcmSample, _buffer[_bufferPos] >> 4);
+				sample = out << 8;
+			}
+		} else {
+			if (_audioFlags & kSolFlag16Bit) {
+				if (_bufferPos + 1 >= _bufferSize) {
+					// Sample got split by the buffer
+					byte low = _buffer[_bufferPos];
+					if (!fillBuffer())
+						break;
+					sample = low | (_buffer[_bufferPos++] << 8);
+				} else {
+					sample = READ_LE_UINT16(_buffer + _bufferPos);
+					_bufferPos += 2;
+				}
+			} else {
+				sample = _buffer[_bufferPos++] << 8;
+			}
+		}
+
+		*buffer++ = (int16)(sample ^ _unsignedMask);
+		samples++;
+		_curSample++;
+	}
+
+	return samples;
+}
+
+bool SOLStream::seek(const Audio::Timestamp &where) {
+	const uint32 seekSample = Audio::convertTimeToStreamPos(where, _rate, false).totalNumberOfFrames();
+
+	if (seekSample > _sampleCount)
+		return false;
+
+	_bufferPos = _bufferSize = 0;
+
+	if (!(_audioFlags & kSolFlagCompressed)) {
+		_curSample = seekSample;
+		return _stream->seek(seekSample * ((_audioFlags & kSolFlag16Bit) ? 2 : 1), SEEK_SET);
+	}
+
+	// Every DPCM sample depends on all samples before it, so we have to
+	//  decode from the start
+	_curSample = 0;
+	_dpcmSample = (_audioFlags & kSolFlag16Bit) ? 0 : 0x80;
+	if (!_stream->seek(0, SEEK_SET))
+		return false;
+
+	int16 skipBuffer[1024];
+	while (_curSample < seekSample) {
+		if (!readBuffer(skipBuffer, MIN<uint32>(ARRAYSIZE(skipBuffer), seekSample - _curSample)))
+			return false;
+	}
+	return true;
+}
+
 byte *AudioPlayer::getDecodedRobotAudioFrame(Common::SeekableReadStream *str, uint32 encodedSize) {
 	byte flags = 0;
 	return readSOLAudio(str, encodedSize, kSolFlagCompressed | kSolFlag16Bit, flags);
@@ -256,6 +397,24 @@ Audio::RewindableAudioStream *AudioPlayer::getAudioStream(uint32 number, uint32
 
 	*sampleLen = 0;
 
+	// SCI1.1 audio inside of uncompressed audio volumes gets streamed right
+	//  from the volume, so that long speech samples don't have to be loaded
+	//  and decoded completely before they start
+	ResourceId audioId = (volume == 65535) ? ResourceId(kResourceTypeAudio, number) : ResourceId(kResourceTypeAudio36, volume, number);
+	uint32 headerSize = 0;
+	Common::SeekableReadStream *solStream = _resMan->getAudioResourceStream(audioId, headerSize);
+	if (solStream) {
+		byte audioFlags;
+		if (readSOLHeader(solStream, headerSize, size, _audioRate, audioFlags, solStream->size() - headerSize)
+				&& headerSize + size <= (uint32)solStream->size()) {
+			Common::SeekableReadStream *dataStream = new Common::SeekableSubReadStream(solStream, headerSize, headerSize + size, DisposeAfterUse::YES);
+			audioSeekStream = new SOLStream(dataStream, _audioRate, audioFlags);
+			*sampleLen = (audioSeekStream->getLength().msecs() * 60) / 1000; // we translate msecs to ticks
+			return audioSeekStream;
+		}
+		delete solStream;
+	}
+
 	if (volume == 65535) {
 		audioRes = _resMan->findResource(ResourceId(kResourceTypeAudio, number), false);
 		if (!audioRes) {
@@ -75,6 +75,10 @@ RobotDecoder::RobotDecoder(bool isBigEndian) {
 	_pos = Common::Point(0, 0);
 	_isBigEndian = isBigEndian;
 	_frameTotalSize = 0;
+	memset(_frames, 0, sizeof(_frames));
+	_firstFrame = 0;
+	_framesQueued = 0;
+	_framesRead = 0;
 }
 
 RobotDecoder::~RobotDecoder() {
@@ -139,6 +143,32 @@ void RobotDecoder::close() {
 
 	delete[] _frameTotalSize;
 	_frameTotalSize = 0;
+
+	freeFrames();
+}
+
+void RobotDecoder::freeFrames() {
+	for (int i = 0; i < kRobotFrameAhead; i++) {
+		delete[] _frames[i].pixels;
+		_frames[i].pixels = 0;
+		_frames[i].pixelsSize = 0;
+	}
+	_firstFrame = 0;
+	_framesQueued = 0;
+	_framesRead = 0;
+}
+
+bool RobotDecoder::decodeAhead() {
+	if (!_fileStream || _framesQueued == kRobotFrameAhead)
+		return false;
+
+	// readNextPacket() never shows the last frame, so don't read it either
+	if (_framesRead >= _header.frameCount - 1)
+		return false;
+
+	readFrame(_frames[(_firstFrame + _framesQueued) % kRobotFrameAhead]);
+	_framesQueued++;
+	return true;
 }
 
 void RobotDecoder::readNextPacket() {
@@ -150,6 +180,34 @@ void RobotDecoder::readNextPacket() {
 	if (videoTrack->endOfTrack())
 		return;
 
+	// Use the frame that got decoded ahead, or decode it right now
+	if (!_framesQueued && !decodeAhead())
+		return;
+	RobotFrame &frame = _frames[_firstFrame];
+	_firstFrame = (_firstFrame + 1) % kRobotFrameAhead;
+	_framesQueued--;
+
+	// Copy over the decompressed frame, blacking out the rest of the surface
+	byte *inFrame = frame.pixels;
+	byte *outFrame = (byte *)surface->pixels;
+
+	for (uint16 y = 0; y < surface->h; y++) {
+		if (y < frame.y || y >= frame.y + frame.height) {
+			memset(outFrame, 0, surface->w);
+		} else {
+			memset(outFrame, 0, frame.x);
+			memcpy(outFrame + frame.x, inFrame, frame.width);
+			memset(outFrame + frame.x + frame.width, 0, surface->w - frame.x - frame.width);
+			inFrame += frame.width;
+		}
+		outFrame += surface->pitch;
+	}
+}
+
+void RobotDecoder::readFrame(RobotFrame &frame) {
+	RobotVideoTrack *videoTrack = (RobotVideoTrack *)getTrack(0);
+	Graphics::Surface *surface = videoTrack->getSurface();
+
 	// Read frame image header (24 bytes)
 	_fileStream->skip(3);
 	byte frameScale = _fileStream->readByte();
@@ -182,8 +240,13 @@ void RobotDecoder::readNextPacket() {
 	assert(frameWidth + frameX <= surface->w && scaledHeight + frameY <= surface->h);
 
 	DecompressorLZS lzs;
-	byte *decompressedFrame = new byte[decompressedSize];
-	byte *outPtr = decompressedFrame;
+	// The frame buffers are reused, and only grow when needed
+	if (frame.pixelsSize < decompressedSize) {
+		delete[] frame.pixels;
+		frame.pixels = new byte[decompressedSize];
+		frame.pixelsSize = decompressedSize;
+	}
+	byte *outPtr = frame.pixels;
 
 	if (_header.version == 4) {
 		// v4 has just the one fragment, it seems, and ignores the fragment count
@@ -208,25 +271,12 @@ void RobotDecoder::readNextPacket() {
 		}
 	}
 
-	// Copy over the decompressed frame
-	byte *inFrame = decompressedFrame;
-	byte *outFrame = (byte *)surface->pixels;
-
-	// Black out the surface
-	memset(outFrame, 0, surface->w * surface->h);
-
-	// Move to the correct y coordinate
-	outFrame += surface->w * frameY;
-
-	for (uint16 y = 0; y < scaledHeight; y++) {
-		memcpy(outFrame + frameX, inFrame, frameWidth);
-		inFrame += frameWidth;
-		outFrame += surface->w;
-	}
-
-	delete[] decompressedFrame;
+	frame.x = frameX;
+	frame.y = frameY;
+	frame.width = frameWidth;
+	frame.height = scaledHeight;
 
-	uint32 audioChunkSize = _frameTotalSize[videoTrack->getCurFrame()] - (24 + compressedSize);
+	uint32 audioChunkSize = _frameTotalSize[_framesRead++] - (24 + compressedSize);
 
 // TODO: The audio chunk size below is usually correct, but there are some
 // exceptions (e.g. robot 4902 in Phantasmagoria, towards its end)
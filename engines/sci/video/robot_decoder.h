@@ -49,6 +49,14 @@ public:
 	void setPos(uint16 x, uint16 y) { _pos = Common::Point(x, y); }
 	Common::Point getPos() const { return _pos; }
 
+	/**
+	 * Decompresses the next frame ahead of time, so that it's ready when it
+	 * is due. Meant to be called while waiting for the next frame.
+	 * @return true if a frame got decoded, false if the queue of decoded
+	 *         frames is full or all frames got read already
+	 */
+	bool decodeAhead();
+
 protected:
 	void readNextPacket();
 
@@ -113,13 +121,34 @@ private:
 		// 34 bytes, unknown
 	} _header;
 
+	/** A decompressed frame, waiting to be shown */
+	struct RobotFrame {
+		byte *pixels;
+		uint32 pixelsSize; // allocated size of pixels
+		uint16 x;
+		uint16 y;
+		uint16 width;
+		uint16 height;
+	};
+
+	enum {
+		kRobotFrameAhead = 3 // Maximum number of frames decoded ahead
+	};
+
 	void readHeaderChunk();
 	void readFrameSizesChunk();
+	void readFrame(RobotFrame &frame);
+	void freeFrames();
 
 	Common::Point _pos;
 	bool _isBigEndian;
 	uint32 *_frameTotalSize;
 
+	RobotFrame _frames[kRobotFrameAhead];
+	int _firstFrame;  // Index of the next frame to be shown in _frames
+	int _framesQueued; // Number of decoded frames in _frames
+	int _framesRead;  // Number of frames read from the stream
+
 	Common::SeekableSubReadStreamEndian *_fileStream;
 };
 
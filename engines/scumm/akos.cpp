@@ -335,10 +335,16 @@ void AkosRenderer::setPalette(uint16 *new_palette) {
 	}
 }
 
+AkosRenderer::~AkosRenderer() {
+	akos16FlushCache();
+}
+
 void AkosRenderer::setCostume(int costume, int shadow) {
 	const byte *akos = _vm->getResourceAddress(rtCostume, costume);
 	assert(akos);
 
+	_costume = costume;
+
 	akhd = (const AkosHeader *) _vm->findResourceData(MKTAG('A','K','H','D'), akos);
 	akof = (const AkosOffset *) _vm->findResourceData(MKTAG('A','K','O','F'), akos);
 	akci = _vm->findResourceData(MKTAG('A','K','C','I'), akos);
@@ -1145,22 +1151,94 @@ void AkosRenderer::akos16DecodeLine(byte *buf, int32 numbytes, int32 dir) {
 	}
 }
 
+void AkosRenderer::akos16FlushCache() {
+	for (int i = 0; i < kAkos16CacheEntries; i++) {
+		free(_akos16Cache[i].data);
+		_akos16Cache[i].data = 0;
+	}
+	_akos16CacheSize = 0;
+}
+
+/**
+ * Return the current AKOS16 frame fully decoded, or NULL if it is too big
+ * to be cached. Frames are identified by costume number and the position
+ * of their data, as the costume resource itself may be expired and
+ * reloaded at a different address.
+ */
+const byte *AkosRenderer::akos16GetFrame(const byte *src) {
+	const uint32 offset = src - akcd;
+	const uint32 size = _width * _height;
+	int i;
+
+	if (size > kAkos16CacheBudget / 4)
+		return 0;
+
+	for (i = 0; i < kAkos16CacheEntries; i++) {
+		Akos16Frame &frame = _akos16Cache[i];
+		if (frame.data && frame.costume == _costume && frame.offset == offset && frame.width == _width && frame.height == _height) {
+			frame.lastUse = ++_akos16CacheUse;
+			return frame.data;
+		}
+	}
+
+	// Throw out the least recently used frames until there is a free
+	// entry and the new frame fits into the budget
+	Akos16Frame *entry;
+	while (1) {
+		Akos16Frame *oldest = 0;
+		entry = 0;
+		for (i = 0; i < kAkos16CacheEntries; i++) {
+			Akos16Frame &frame = _akos16Cache[i];
+			if (!frame.data)
+				entry = &frame;
+			else if (!oldest || frame.lastUse < oldest->lastUse)
+				oldest = &frame;
+		}
+		if (entry && _akos16CacheSize + size <= kAkos16CacheBudget)
+			break;
+
+		_akos16CacheSize -= oldest->width * oldest->height;
+		free(oldest->data);
+		oldest->data = 0;
+	}
+
+	entry->data = (byte *)malloc(size);
+	if (!entry->data)
+		return 0;
+	entry->costume = _costume;
+	entry->offset = offset;
+	entry->width = _width;
+	entry->height = _height;
+	entry->lastUse = ++_akos16CacheUse;
+	_akos16CacheSize += size;
+
+	akos16SetupBitReader(src);
+	akos16DecodeLine(entry->data, size, 1);
+
+	return entry->data;
+}
+
 void AkosRenderer::akos16Decompress(byte *dest, int32 pitch, const byte *src, int32 t_width, int32 t_height, int32 dir,
 		int32 numskip_before, int32 numskip_after, byte transparency, int maskLeft, int maskTop, int zBuf) {
 	byte *tmp_buf = _akos16.buffer;
 	int maskpitch;
 	byte *maskptr;
 	const byte maskbit = revBitMask(maskLeft & 7);
+	const byte *frame = akos16GetFrame(src);
 
 	if (dir < 0) {
 		dest -= (t_width - 1);
 		tmp_buf += (t_width - 1);
 	}
 
-	akos16SetupBitReader(src);
+	if (frame) {
+		frame += numskip_before;
+	} else {
+		akos16SetupBitReader(src);
 
-	if (numskip_before != 0) {
-		akos16SkipData(numskip_before);
+		if (numskip_before != 0) {
+			akos16SkipData(numskip_before);
+		}
 	}
 
 	maskpitch = _numStrips;
@@ -1170,12 +1248,22 @@ void AkosRenderer::akos16Decompress(byte *dest, int32 pitch, const byte *src, in
 	assert(t_height > 0);
 	assert(t_width > 0);
 	while (t_height--) {
-		akos16DecodeLine(tmp_buf, t_width, dir);
+		if (frame) {
+			if (dir > 0) {
+				memcpy(tmp_buf, frame, t_width);
+			} else {
+				for (int32 i = 0; i < t_width; i++)
+					tmp_buf[-i] = frame[i];
+			}
+			frame += t_width + numskip_after;
+		} else {
+			akos16DecodeLine(tmp_buf, t_width, dir);
+		}
 		bompApplyMask(_akos16.buffer, maskptr, maskbit, t_width, transparency);
 		bool HE7Check = (_vm->_game.heversion == 70);
 		bompApplyShadow(_shadow_mode, _shadow_table, _akos16.buffer, dest, t_width, transparency, HE7Check);
 
-		if (numskip_after != 0)	{
+		if (!frame && numskip_after != 0)	{
 			akos16SkipData(numskip_after);
 		}
 		dest += pitch;
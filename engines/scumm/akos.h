@@ -85,6 +85,25 @@ protected:
 		byte buffer[336];
 	} _akos16;
 
+	// Fully decoded AKOS16 frames, so redrawing an actor does not have to
+	// run the bit reader over the whole frame again.
+	struct Akos16Frame {
+		int costume;
+		uint32 offset;		// offset of the frame data in the AKCD block
+		int width, height;
+		uint32 lastUse;
+		byte *data;
+	};
+	enum {
+		kAkos16CacheEntries = 16,
+		kAkos16CacheBudget = 1024 * 1024
+	};
+	Akos16Frame _akos16Cache[kAkos16CacheEntries];
+	uint32 _akos16CacheSize;
+	uint32 _akos16CacheUse;
+
+	int _costume;	// costume number passed to setCostume()
+
 public:
 	AkosRenderer(ScummEngine *scumm) : BaseCostumeRenderer(scumm) {
 		_useBompPalette = false;
@@ -98,7 +117,12 @@ public:
 		rgbs = 0;
 		xmap = 0;
 		_actorHitMode = false;
+		_costume = 0;
+		memset(_akos16Cache, 0, sizeof(_akos16Cache));
+		_akos16CacheSize = 0;
+		_akos16CacheUse = 0;
 	}
+	~AkosRenderer();
 
 	bool _actorHitMode;
 	int16 _actorHitX, _actorHitY;
@@ -120,6 +144,8 @@ protected:
 	void akos16SkipData(int32 numskip);
 	void akos16DecodeLine(byte *buf, int32 numbytes, int32 dir);
 	void akos16Decompress(byte *dest, int32 pitch, const byte *src, int32 t_width, int32 t_height, int32 dir, int32 numskip_before, int32 numskip_after, byte transparency, int maskLeft, int maskTop, int zBuf);
+	const byte *akos16GetFrame(const byte *src);
+	void akos16FlushCache();
 
 	void markRectAsDirty(Common::Rect rect);
 };
@@ -100,6 +100,12 @@ void bompDecodeLineReverse(byte *dst, const byte *src, int len) {
 
 void bompApplyMask(byte *line_buffer, byte *mask, byte maskbit, int32 size, byte transparency) {
 	while (1) {
+		// Step over whole mask bytes with nothing masked
+		while (maskbit == 128 && size >= 8 && !*mask) {
+			line_buffer += 8;
+			size -= 8;
+			mask++;
+		}
 		do {
 			if (size-- == 0)
 				return;
@@ -131,15 +137,24 @@ void bompApplyShadow(int shadowMode, const byte *shadowPalette, const byte *line
 	}
 }
 void bompApplyShadow0(const byte *shadowPalette, const byte *line_buffer, byte *dst, int32 size, byte transparency, bool HE7Check) {
-	while (size-- > 0) {
-		byte tmp = *line_buffer++;
-		if (tmp != transparency) {
-			if (HE7Check)
-				*dst = shadowPalette[tmp];
-			else
-				*dst = tmp;
+	while (size > 0) {
+		// Copy a run of opaque pixels at once...
+		int32 run = 0;
+		while (run < size && line_buffer[run] != transparency)
+			run++;
+		if (HE7Check) {
+			for (int32 i = 0; i < run; i++)
+				dst[i] = shadowPalette[line_buffer[i]];
+		} else {
+			memcpy(dst, line_buffer, run);
 		}
-		dst++;
+
+		// ...and skip the transparent ones following it
+		while (run < size && line_buffer[run] == transparency)
+			run++;
+		line_buffer += run;
+		dst += run;
+		size -= run;
 	}
 }
 
@@ -206,6 +206,8 @@ void ScummEngine::setBoxFlags(int box, int val) {
 		else
 			ptr->old.flags = val;
 	}
+
+	invalidateBoxCache();
 }
 
 byte ScummEngine::getBoxFlags(int box) {
@@ -571,7 +573,47 @@ bool ScummEngine::checkXYInBoxBounds(int boxnum, int x, int y) {
 	return true;
 }
 
+enum {
+	kNextBoxUnknown = -2
+};
+
+void ScummEngine::invalidateBoxCache() {
+	_boxCacheValid = false;
+	_boxCoordsCache.clear();
+	_nextBoxCache.clear();
+	_itineraryCache.clear();
+}
+
+void ScummEngine::updateBoxCache() {
+	if (_boxCacheValid)
+		return;
+
+	const int numOfBoxes = getNumBoxes();
+
+	_boxCoordsCache.resize(numOfBoxes);
+	for (int i = 0; i < numOfBoxes; i++)
+		_boxCoordsCache[i] = readBoxCoordinates(i);
+
+	_nextBoxCache.resize(numOfBoxes * numOfBoxes);
+	for (uint i = 0; i < _nextBoxCache.size(); i++)
+		_nextBoxCache[i] = kNextBoxUnknown;
+
+	_itineraryCache.clear();
+	_boxCacheValid = true;
+}
+
 BoxCoords ScummEngine::getBoxCoordinates(int boxnum) {
+	updateBoxCache();
+
+	// Out of range box numbers are left to readBoxCoordinates(), which
+	// applies the workarounds in getBoxBaseAddr().
+	if (boxnum >= 0 && boxnum < (int)_boxCoordsCache.size())
+		return _boxCoordsCache[boxnum];
+
+	return readBoxCoordinates(boxnum);
+}
+
+BoxCoords ScummEngine::readBoxCoordinates(int boxnum) {
 	BoxCoords tmp, *box = &tmp;
 	Box *bp = getBoxBaseAddr(boxnum);
 	assert(bp);
@@ -699,10 +741,7 @@ byte *ScummEngine::getBoxMatrixBaseAddr() {
  * If there is no connection -1 is return.
  */
 int ScummEngine::getNextBox(byte from, byte to) {
-	const byte *boxm;
-	byte i;
 	const int numOfBoxes = getNumBoxes();
-	int dest = -1;
 
 	if (from == to)
 		return to;
@@ -716,22 +755,39 @@ int ScummEngine::getNextBox(byte from, byte to) {
 	assert(from < numOfBoxes);
 	assert(to < numOfBoxes);
 
+	// Routes only change together with the boxes, so look them up once
+	updateBoxCache();
+	if ((int)_nextBoxCache.size() != numOfBoxes * numOfBoxes)
+		return findNextBox(from, to, numOfBoxes);
+
+	int16 &dest = _nextBoxCache[numOfBoxes * from + to];
+	if (dest == kNextBoxUnknown)
+		dest = findNextBox(from, to, numOfBoxes);
+	return dest;
+}
+
+int ScummEngine::findNextBox(byte from, byte to, int numOfBoxes) {
+	const byte *boxm;
+	byte i;
+	int dest = -1;
+
 	boxm = getBoxMatrixBaseAddr();
 
 	if (_game.version == 0) {
 		// calculate shortest paths
-		byte *itineraryMatrix = (byte *)malloc(numOfBoxes * numOfBoxes);
-		calcItineraryMatrix(itineraryMatrix, numOfBoxes);
+		if (_itineraryCache.size() != (uint)(numOfBoxes * numOfBoxes)) {
+			_itineraryCache.resize(numOfBoxes * numOfBoxes);
+			calcItineraryMatrix(_itineraryCache.begin(), numOfBoxes);
+		}
 
 		dest = to;
 		do {
-			dest = itineraryMatrix[numOfBoxes * from + dest];
+			dest = _itineraryCache[numOfBoxes * from + dest];
 		} while (dest != Actor::kInvalidBox && !areBoxesNeighbors(from, dest));
 
 		if (dest == Actor::kInvalidBox)
 			dest = -1;
 
-		free(itineraryMatrix);
 		return dest;
 	} else if (_game.version <= 2) {
 		// The v2 box matrix is a real matrix with numOfBoxes rows and columns.
@@ -1030,6 +1086,7 @@ void ScummEngine::createBoxMatrix() {
 	// See also getNextBox.
 
 	byte *matrixStart = _res->createResource(rtMatrix, 1, BOX_MATRIX_SIZE);
+	invalidateBoxCache();
 	const byte *matrixEnd = matrixStart + BOX_MATRIX_SIZE;
 
 	#define addToMatrix(b)	do { *matrixStart++ = (b); assert(matrixStart < matrixEnd); } while (0)
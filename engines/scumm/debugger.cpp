@@ -20,6 +20,7 @@
  *
  */
 
+#include "common/algorithm.h"
 #include "common/debug-channels.h"
 #include "common/file.h"
 #include "common/str.h"
@@ -30,6 +31,9 @@
 #include "scumm/boxes.h"
 #include "scumm/debugger.h"
 #include "scumm/imuse/imuse.h"
+#ifdef ENABLE_SCUMM_7_8
+#include "scumm/imuse_digi/dimuse.h"
+#endif
 #include "scumm/object.h"
 #include "scumm/resource.h"
 #include "scumm/scumm.h"
@@ -78,7 +82,9 @@ ScummDebugger::ScummDebugger(ScummEngine *s)
 	DCmd_Register("script",    WRAP_METHOD(ScummDebugger, Cmd_Script));
 	DCmd_Register("scr",       WRAP_METHOD(ScummDebugger, Cmd_Script));
 	DCmd_Register("scripts",   WRAP_METHOD(ScummDebugger, Cmd_PrintScript));
+	DCmd_Register("opcodes",   WRAP_METHOD(ScummDebugger, Cmd_Opcodes));
 	DCmd_Register("importres", WRAP_METHOD(ScummDebugger, Cmd_ImportRes));
+	DCmd_Register("resources", WRAP_METHOD(ScummDebugger, Cmd_Resources));
 
 	if (_vm->_game.id == GID_LOOM)
 		DCmd_Register("drafts",  WRAP_METHOD(ScummDebugger, Cmd_PrintDraft));
@@ -155,6 +161,17 @@ bool ScummDebugger::Cmd_IMuse(int argc, const char **argv) {
 				DebugPrintf("Specify a music resource # or \"all\".\n");
 			}
 			return true;
+#ifdef ENABLE_SCUMM_7_8
+		} else if (!strcmp(argv[1], "cache")) {
+			if (!_vm->_imuseDigital) {
+				DebugPrintf("Bundle cache is only used by iMuse Digital.\n");
+				return true;
+			}
+			uint32 hits, misses, readAheads;
+			_vm->_imuseDigital->getBundleCacheStats(hits, misses, readAheads);
+			DebugPrintf("Bundle block cache: %u hits, %u misses, %u blocks read ahead\n", hits, misses, readAheads);
+			return true;
+#endif
 		}
 	}
 
@@ -162,6 +179,9 @@ bool ScummDebugger::Cmd_IMuse(int argc, const char **argv) {
 	DebugPrintf("  panic - Stop all music tracks\n");
 	DebugPrintf("  play # - Play a music resource\n");
 	DebugPrintf("  stop # - Stop a music resource\n");
+#ifdef ENABLE_SCUMM_7_8
+	DebugPrintf("  cache - Show iMuse Digital bundle cache statistics\n");
+#endif
 	return true;
 }
 
@@ -311,6 +331,14 @@ bool ScummDebugger::Cmd_ImportRes(int argc, const char** argv) {
 	return true;
 }
 
+bool ScummDebugger::Cmd_Resources(int argc, const char **argv) {
+	const ResourceManager::Stats &stats = _vm->_res->_stats;
+
+	DebugPrintf("Allocated: %d of %d bytes\n", _vm->_res->getAllocatedSize(), _vm->_res->getMaxHeapThreshold());
+	DebugPrintf("Loaded: %d, expired: %d (%d bytes)\n", stats.loads, stats.expired, stats.expiredSize);
+	return true;
+}
+
 bool ScummDebugger::Cmd_PrintScript(int argc, const char **argv) {
 	int i;
 	ScriptSlot *ss = _vm->vm.slot;
@@ -330,6 +358,62 @@ bool ScummDebugger::Cmd_PrintScript(int argc, const char **argv) {
 	return true;
 }
 
+struct OpcodeProfileEntry {
+	uint32 key;
+	uint32 count;
+	uint32 millis;
+};
+
+static bool opcodeProfileLess(const OpcodeProfileEntry &a, const OpcodeProfileEntry &b) {
+	if (a.millis != b.millis)
+		return a.millis > b.millis;
+	return a.count > b.count;
+}
+
+bool ScummDebugger::Cmd_Opcodes(int argc, const char **argv) {
+	if (argc == 2 && !strcmp(argv[1], "on")) {
+		_vm->_profileOpcodes = true;
+		DebugPrintf("Opcode profiling on\n");
+		return true;
+	} else if (argc == 2 && !strcmp(argv[1], "off")) {
+		_vm->_profileOpcodes = false;
+		DebugPrintf("Opcode profiling off\n");
+		return true;
+	} else if (argc == 2 && !strcmp(argv[1], "clear")) {
+		_vm->_opcodeProfile.clear();
+		return true;
+	} else if (argc > 2 || (argc == 2 && atoi(argv[1]) <= 0)) {
+		DebugPrintf("Syntax: opcodes [on|off|clear|<count>]\n");
+		return true;
+	}
+
+	uint count = (argc == 2) ? atoi(argv[1]) : 20;
+
+	Common::Array<OpcodeProfileEntry> entries;
+	for (ScummEngine::OpcodeProfileMap::const_iterator it = _vm->_opcodeProfile.begin(); it != _vm->_opcodeProfile.end(); ++it) {
+		OpcodeProfileEntry entry;
+		entry.key = it->_key;
+		entry.count = it->_value.count;
+		entry.millis = it->_value.millis;
+		entries.push_back(entry);
+	}
+	Common::sort(entries.begin(), entries.end(), opcodeProfileLess);
+
+	DebugPrintf("Opcode profiling is %s\n", _vm->_profileOpcodes ? "on" : "off");
+	DebugPrintf("+------+----+----------+--------+-------------------------\n");
+	DebugPrintf("|script| op |     count| time ms| name\n");
+	DebugPrintf("+------+----+----------+--------+-------------------------\n");
+	for (uint i = 0; i < entries.size() && i < count; i++) {
+		const byte opcode = entries[i].key & 0xFF;
+		const char *desc = _vm->getOpcodeDesc(opcode);
+		DebugPrintf("|%6d| %02X |%10d|%8d| %s\n", entries[i].key >> 8, opcode,
+				entries[i].count, entries[i].millis, desc ? desc : "");
+	}
+	DebugPrintf("+------+----+----------+--------+-------------------------\n");
+
+	return true;
+}
+
 bool ScummDebugger::Cmd_Actor(int argc, const char **argv) {
 	Actor *a;
 	int actnum;
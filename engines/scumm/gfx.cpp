@@ -213,6 +213,12 @@ Gdi::Gdi(ScummEngine *vm) : _vm(vm) {
 	_vertStripNextInc = 0;
 	_zbufferDisabled = false;
 	_objectMode = false;
+	_bgCache.ptr = 0;
+	_bgCache.roomResource = 0;
+	_bgCache.height = 0;
+	_bgCache.bytesPerPixel = 0;
+	_bgCache.numzbuf = 0;
+	memset(_bgCache.roomPalette, 0, sizeof(_bgCache.roomPalette));
 	_distaff = false;
 }
 
@@ -274,6 +280,7 @@ void Gdi::init() {
 }
 
 void Gdi::roomChanged(byte *roomptr) {
+	clearBackgroundCache();
 }
 
 void GdiNES::roomChanged(byte *roomptr) {
@@ -1007,7 +1014,14 @@ void ScummEngine::redrawBGStrip(int start, int num) {
 	else
 		room = getResourceAddress(rtRoom, _roomResource);
 
-	_gdi->drawBitmap(room + _IM00_offs, &_virtscr[kMainVirtScreen], s, 0, _roomWidth, _virtscr[kMainVirtScreen].h, s, num, 0);
+	// Only the generic strip decoders are cached, the V1/V2, NES and PC-Engine
+	// versions decode their room graphics differently, and HE games may draw
+	// into the room image.
+	byte flag = 0;
+	if (_game.version >= 3 && _game.heversion == 0 && _game.platform != Common::kPlatformPCEngine)
+		flag = Gdi::dbCacheStrips;
+
+	_gdi->drawBitmap(room + _IM00_offs, &_virtscr[kMainVirtScreen], s, 0, _roomWidth, _virtscr[kMainVirtScreen].h, s, num, flag);
 }
 
 void ScummEngine::restoreBackground(Common::Rect rect, byte backColor) {
@@ -1797,6 +1811,10 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 	_objectMode = (flag & dbObjectMode) == dbObjectMode;
 	prepareDrawBitmap(ptr, vs, x, y, width, height, stripnr, numstrip);
 
+	const bool useCache = (flag & dbCacheStrips) && y == 0;
+	if (useCache)
+		prepareBackgroundCache(ptr, vs, height, numzbuf);
+
 	sx = x - vs->xstart / 8;
 	if (sx < 0) {
 		numstrip -= -sx;
@@ -1829,7 +1847,12 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 		else
 			dstPtr = (byte *)vs->pixels + y * vs->pitch + (x * 8 * vs->format.bytesPerPixel);
 
-		transpStrip = drawStrip(dstPtr, vs, x, y, width, height, stripnr, smap_ptr);
+		const bool cachedStrip = useCache && restoreBackgroundStrip(dstPtr, vs, x, y, height, stripnr, numzbuf, zplane_list);
+		if (!cachedStrip)
+			transpStrip = drawStrip(dstPtr, vs, x, y, width, height, stripnr, smap_ptr);
+		else
+			transpStrip = false;
+		const bool cacheStrip = useCache && !cachedStrip && !transpStrip;
 
 		// COMI and HE games only uses flag value
 		if (_vm->_game.version == 8 || _vm->_game.heversion >= 60)
@@ -1843,7 +1866,10 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 				clear8Col(frontBuf, vs->pitch, height, vs->format.bytesPerPixel);
 		}
 
-		decodeMask(x, y, width, height, stripnr, numzbuf, zplane_list, transpStrip, flag);
+		if (!cachedStrip)
+			decodeMask(x, y, width, height, stripnr, numzbuf, zplane_list, transpStrip, flag);
+		if (cacheStrip)
+			cacheBackgroundStrip(dstPtr, vs, x, y, height, stripnr, numzbuf, zplane_list);
 
 #if 0
 		// HACK: blit mask(s) onto normal screen. Useful to debug masking
@@ -1871,6 +1897,95 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 	}
 }
 
+void Gdi::clearBackgroundCache() {
+	_bgCache.ptr = 0;
+	_bgCache.cached.clear();
+	_bgCache.pixels.clear();
+	_bgCache.masks.clear();
+}
+
+/**
+ * Checks whether the cached strips were decoded from the same room image in
+ * the same way, and starts over with an empty cache otherwise.
+ */
+void Gdi::prepareBackgroundCache(const byte *ptr, const VirtScreen *vs, int height, int numzbuf) {
+	if (_bgCache.ptr != ptr || _bgCache.roomResource != _vm->_roomResource || _bgCache.height != height ||
+		_bgCache.bytesPerPixel != vs->format.bytesPerPixel || _bgCache.numzbuf != numzbuf ||
+		memcmp(_bgCache.roomPalette, _vm->_roomPalette, sizeof(_bgCache.roomPalette))) {
+		clearBackgroundCache();
+
+		_bgCache.ptr = ptr;
+		_bgCache.roomResource = _vm->_roomResource;
+		_bgCache.height = height;
+		_bgCache.bytesPerPixel = vs->format.bytesPerPixel;
+		_bgCache.numzbuf = numzbuf;
+		memcpy(_bgCache.roomPalette, _vm->_roomPalette, sizeof(_bgCache.roomPalette));
+	}
+}
+
+void Gdi::cacheBackgroundStrip(const byte *dstPtr, const VirtScreen *vs, int x, int y, int height,
+					int stripnr, int numzbuf, const byte *zplane_list[9]) {
+	const int stripSize = 8 * height * _bgCache.bytesPerPixel;
+	const int maskSize = height * MAX(numzbuf - 1, 0);
+
+	if (stripnr >= (int)_bgCache.cached.size()) {
+		_bgCache.cached.resize(stripnr + 1);
+		_bgCache.pixels.resize((stripnr + 1) * stripSize);
+		_bgCache.masks.resize((stripnr + 1) * maskSize);
+	}
+
+	byte *dst = &_bgCache.pixels[stripnr * stripSize];
+	for (int h = 0; h < height; h++) {
+		memcpy(dst, dstPtr, 8 * _bgCache.bytesPerPixel);
+		dst += 8 * _bgCache.bytesPerPixel;
+		dstPtr += vs->pitch;
+	}
+
+	// Masks without data are left untouched by decodeMask(), and are
+	// skipped here and when restoring as well
+	for (int i = 1; i < numzbuf; i++) {
+		if (!zplane_list[i])
+			continue;
+		const byte *mask_ptr = getMaskBuffer(x, y, i);
+		byte *maskDst = &_bgCache.masks[stripnr * maskSize + (i - 1) * height];
+		for (int h = 0; h < height; h++) {
+			*maskDst++ = *mask_ptr;
+			mask_ptr += _numStrips;
+		}
+	}
+
+	_bgCache.cached[stripnr] = true;
+}
+
+bool Gdi::restoreBackgroundStrip(byte *dstPtr, const VirtScreen *vs, int x, int y, int height,
+					int stripnr, int numzbuf, const byte *zplane_list[9]) {
+	if (stripnr >= (int)_bgCache.cached.size() || !_bgCache.cached[stripnr])
+		return false;
+
+	const int stripSize = 8 * height * _bgCache.bytesPerPixel;
+	const int maskSize = height * MAX(numzbuf - 1, 0);
+
+	const byte *src = &_bgCache.pixels[stripnr * stripSize];
+	for (int h = 0; h < height; h++) {
+		memcpy(dstPtr, src, 8 * _bgCache.bytesPerPixel);
+		src += 8 * _bgCache.bytesPerPixel;
+		dstPtr += vs->pitch;
+	}
+
+	for (int i = 1; i < numzbuf; i++) {
+		if (!zplane_list[i])
+			continue;
+		byte *mask_ptr = getMaskBuffer(x, y, i);
+		const byte *maskSrc = &_bgCache.masks[stripnr * maskSize + (i - 1) * height];
+		for (int h = 0; h < height; h++) {
+			*mask_ptr = *maskSrc++;
+			mask_ptr += _numStrips;
+		}
+	}
+
+	return true;
+}
+
 bool Gdi::drawStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int width, const int height,
 					int stripnr, const byte *smap_ptr) {
 	// Do some input verification and make sure the strip/strip offset
@@ -3317,6 +3432,30 @@ void Gdi::drawStripEGA(byte *dst, int dstPitch, const byte *src, int height) con
 	}
 }
 
+/**
+ * Number of trailing zero bits of a byte (8 for 0). A '0' code in the
+ * bitstream strip codecs keeps the current color, so this gives the length of
+ * a run of repeated pixels for the next eight codes.
+ */
+static const byte zeroBitRun[256] = {
+	8, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	5, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	6, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	5, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	7, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	5, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	6, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	5, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+};
+
 #define READ_BIT (shift--, dataBit = data & 1, data >>= 1, dataBit)
 #define FILL_BITS(n) do {            \
 		if (shift < n) {             \
@@ -3339,10 +3478,15 @@ void Gdi::drawStripHE(byte *dst, int dstPitch, const byte *src, int width, int h
 
 	int x = width;
 	while (1) {
+		// Every '0' code repeats the color, so draw a whole run of them (up
+		// to the end of the row) at once. Bits above 'shift' are always zero.
+		const int run = MIN<int>(MIN<int>(zeroBitRun[data & 0xFF], shift), x - 1);
 		if (!transpCheck || color != _transparentColor)
-			writeRoomColor(dst, color);
-		dst += _vm->_bytesPerPixel;
-		--x;
+			writeRoomColorRun(dst, _vm->_bytesPerPixel, color, run + 1);
+		dst += (run + 1) * _vm->_bytesPerPixel;
+		data >>= run;
+		shift -= run;
+		x -= run + 1;
 		if (x == 0) {
 			x = width;
 			dst += dstPitch - width * _vm->_bytesPerPixel;
@@ -3423,14 +3567,24 @@ void Gdi::drawStripComplex(byte *dst, int dstPitch, const byte *src, int height,
 	byte cl = 8;
 	byte bit;
 	byte incm, reps;
+	int run;
 
 	do {
 		int x = 8;
 		do {
 			FILL_BITS;
+			// FILL_BITS leaves at least 9 bits, peek at the next 8 codes and
+			// draw the run of '0' (same color) codes within this row at once
+			run = MIN<int>(zeroBitRun[bits & 0xFF], x - 1);
 			if (!transpCheck || color != _transparentColor)
-				writeRoomColor(dst, color);
-			dst += _vm->_bytesPerPixel;
+				writeRoomColorRun(dst, _vm->_bytesPerPixel, color, run + 1);
+			dst += (run + 1) * _vm->_bytesPerPixel;
+			if (run) {
+				x -= run;
+				bits >>= run;
+				cl -= run;
+				FILL_BITS;
+			}
 
 		againPos:
 			if (!READ_BIT) {
@@ -3480,9 +3634,16 @@ void Gdi::drawStripBasicH(byte *dst, int dstPitch, const byte *src, int height,
 		int x = 8;
 		do {
 			FILL_BITS;
+			const int run = MIN<int>(zeroBitRun[bits & 0xFF], x - 1);
 			if (!transpCheck || color != _transparentColor)
-				writeRoomColor(dst, color);
-			dst += _vm->_bytesPerPixel;
+				writeRoomColorRun(dst, _vm->_bytesPerPixel, color, run + 1);
+			dst += (run + 1) * _vm->_bytesPerPixel;
+			if (run) {
+				x -= run;
+				bits >>= run;
+				cl -= run;
+				FILL_BITS;
+			}
 			if (!READ_BIT) {
 			} else if (!READ_BIT) {
 				FILL_BITS;
@@ -3513,9 +3674,16 @@ void Gdi::drawStripBasicV(byte *dst, int dstPitch, const byte *src, int height,
 		int h = height;
 		do {
 			FILL_BITS;
+			const int run = MIN<int>(zeroBitRun[bits & 0xFF], h - 1);
 			if (!transpCheck || color != _transparentColor)
-				writeRoomColor(dst, color);
-			dst += dstPitch;
+				writeRoomColorRun(dst, dstPitch, color, run + 1);
+			dst += (run + 1) * dstPitch;
+			if (run) {
+				h -= run;
+				bits >>= run;
+				cl -= run;
+				FILL_BITS;
+			}
 			if (!READ_BIT) {
 			} else if (!READ_BIT) {
 				FILL_BITS;
@@ -3719,6 +3887,23 @@ void Gdi::writeRoomColor(byte *dst, byte color) const {
 	*dst = _roomPalette[(color + _paletteMod) & 0xFF];
 }
 
+void Gdi::writeRoomColorRun(byte *dst, int step, byte color, int count) const {
+	if (_vm->_bytesPerPixel == 1) {
+		// Map the color only once for the whole run
+		byte value;
+		writeRoomColor(&value, color);
+		if (step == 1) {
+			memset(dst, value, count);
+		} else {
+			for (; count > 0; --count, dst += step)
+				*dst = value;
+		}
+	} else {
+		for (; count > 0; --count, dst += step)
+			writeRoomColor(dst, color);
+	}
+}
+
 
 #pragma mark -
 #pragma mark --- Transition effects ---
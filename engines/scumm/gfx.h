@@ -23,6 +23,7 @@
 #ifndef SCUMM_GFX_H
 #define SCUMM_GFX_H
 
+#include "common/array.h"
 #include "common/system.h"
 #include "common/list.h"
 
@@ -197,6 +198,24 @@ protected:
 	/** Flag which is true when an object is being rendered, false otherwise. */
 	bool _objectMode;
 
+	/**
+	 * Decoded strips of the room background, including their masks. When the
+	 * room background gets redrawn (e.g. while scrolling), cached strips are
+	 * simply copied instead of being decompressed again. Strips which use
+	 * transparency depend on what was drawn before them, and are not cached.
+	 */
+	struct BackgroundCache {
+		const byte *ptr;
+		int roomResource;
+		int height;
+		int bytesPerPixel;
+		int numzbuf;
+		byte roomPalette[256];
+		Common::Array<bool> cached;
+		Common::Array<byte> pixels;
+		Common::Array<byte> masks;
+	} _bgCache;
+
 public:
 	/** Flag which is true when loading objects or titles for distaff, in PCEngine version of Loom. */
 	bool _distaff;
@@ -224,6 +243,8 @@ protected:
 
 	void drawStripHE(byte *dst, int dstPitch, const byte *src, int width, int height, const bool transpCheck) const;
 	virtual void writeRoomColor(byte *dst, byte color) const;
+	/** Write 'count' pixels of the same room color, 'step' bytes apart. */
+	void writeRoomColorRun(byte *dst, int step, byte color, int count) const;
 
 	/* Mask decompressors */
 	void decompressMaskImgOr(byte *dst, const byte *src, int height) const;
@@ -232,6 +253,12 @@ protected:
 	/* Misc */
 	int getZPlanes(const byte *smap_ptr, const byte *zplane_list[9], bool bmapImage) const;
 
+	void prepareBackgroundCache(const byte *ptr, const VirtScreen *vs, int height, int numzbuf);
+	void cacheBackgroundStrip(const byte *dstPtr, const VirtScreen *vs, int x, int y, int height,
+	                int stripnr, int numzbuf, const byte *zplane_list[9]);
+	bool restoreBackgroundStrip(byte *dstPtr, const VirtScreen *vs, int x, int y, int height,
+	                int stripnr, int numzbuf, const byte *zplane_list[9]);
+
 	virtual bool drawStrip(byte *dstPtr, VirtScreen *vs,
 					int x, int y, const int width, const int height,
 					int stripnr, const byte *smap_ptr);
@@ -266,11 +293,13 @@ public:
 	void enableZBuffer() { _zbufferDisabled = false; }
 
 	void resetBackground(int top, int bottom, int strip);
+	void clearBackgroundCache();
 
 	enum DrawBitmapFlags {
 		dbAllowMaskOr   = 1 << 0,
 		dbDrawMaskOnAll = 1 << 1,
-		dbObjectMode    = 2 << 2
+		dbObjectMode    = 2 << 2,
+		dbCacheStrips   = 1 << 4
 	};
 };
 
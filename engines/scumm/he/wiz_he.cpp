@@ -701,6 +701,14 @@ void Wiz::write16BitColor(uint8 *dstPtr, const uint8 *dataPtr, int dstType, cons
 	}
 }
 
+#ifdef SCUMM_LITTLE_ENDIAN
+// Halves two 555 colors packed into one word and adds them to the halved
+// destination pair. Each half stays below 0x10000, so nothing carries over.
+static inline uint32 blend16BitColorPair(uint32 srcColors, uint32 dstColors) {
+	return ((srcColors >> 1) & 0x7DEF7DEF) + ((dstColors >> 1) & 0x7DEF7DEF);
+}
+#endif
+
 template<int type>
 void Wiz::decompress16BitWizImage(uint8 *dst, int dstPitch, int dstType, const uint8 *src, const Common::Rect &srcRect, int flags, const uint8 *xmapPtr) {
 	const uint8 *dataPtr, *dataPtrNext;
@@ -735,6 +743,14 @@ void Wiz::decompress16BitWizImage(uint8 *dst, int dstPitch, int dstType, const u
 		dstInc = -2;
 	}
 
+	// Image data is little endian, so it can be copied as it is to little
+	// endian destinations
+#ifdef SCUMM_LITTLE_ENDIAN
+	const bool rawCopy = (type == kWizCopy && dstInc == 2);
+#else
+	const bool rawCopy = (type == kWizCopy && dstInc == 2 && (dstType == kDstMemory || dstType == kDstResource));
+#endif
+
 	while (h--) {
 		xoff = srcRect.left;
 		w = srcRect.width();
@@ -770,6 +786,15 @@ void Wiz::decompress16BitWizImage(uint8 *dst, int dstPitch, int dstType, const u
 					if (w < 0) {
 						code += w;
 					}
+#ifdef SCUMM_LITTLE_ENDIAN
+					if (type == kWizXMap && dstInc == 2) {
+						const uint32 colors = READ_LE_UINT16(dataPtr) * 0x10001;
+						for (; code >= 2; code -= 2) {
+							WRITE_LE_UINT32(dstPtr, blend16BitColorPair(colors, READ_LE_UINT32(dstPtr)));
+							dstPtr += 4;
+						}
+					}
+#endif
 					while (code--) {
 						write16BitColor<type>(dstPtr, dataPtr, dstType, xmapPtr);
 						dstPtr += dstInc;
@@ -790,6 +815,21 @@ void Wiz::decompress16BitWizImage(uint8 *dst, int dstPitch, int dstType, const u
 					if (w < 0) {
 						code += w;
 					}
+					if (rawCopy) {
+						memcpy(dstPtr, dataPtr, code * 2);
+						dataPtr += code * 2;
+						dstPtr += code * 2;
+						code = 0;
+					}
+#ifdef SCUMM_LITTLE_ENDIAN
+					if (type == kWizXMap && dstInc == 2) {
+						for (; code >= 2; code -= 2) {
+							WRITE_LE_UINT32(dstPtr, blend16BitColorPair(READ_LE_UINT32(dataPtr), READ_LE_UINT32(dstPtr)));
+							dataPtr += 4;
+							dstPtr += 4;
+						}
+					}
+#endif
 					while (code--) {
 						write16BitColor<type>(dstPtr, dataPtr, dstType, xmapPtr);
 						dataPtr += 2;
@@ -869,6 +909,9 @@ void Wiz::decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8
 		dstInc = -bitDepth;
 	}
 
+	// Plain 8 bit copies and remaps can fill whole runs at once
+	const bool fastRuns = (type != kWizXMap && dstInc == 1);
+
 	while (h--) {
 		xoff = srcRect.left;
 		w = srcRect.width();
@@ -904,9 +947,14 @@ void Wiz::decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
-						dstPtr += dstInc;
+					if (fastRuns) {
+						memset(dstPtr, (type == kWizRMap) ? palPtr[*dataPtr] : *dataPtr, code);
+						dstPtr += code;
+					} else {
+						while (code--) {
+							write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
+							dstPtr += dstInc;
+						}
 					}
 					dataPtr++;
 				} else {
@@ -924,10 +972,16 @@ void Wiz::decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
-						dataPtr++;
-						dstPtr += dstInc;
+					if (fastRuns && type == kWizCopy) {
+						memcpy(dstPtr, dataPtr, code);
+						dataPtr += code;
+						dstPtr += code;
+					} else {
+						while (code--) {
+							write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
+							dataPtr++;
+							dstPtr += dstInc;
+						}
 					}
 				}
 			}
@@ -361,6 +361,15 @@ void IMuseDigital::callback() {
 			}
 		}
 	}
+
+	// Decompress the next bundle block of each playing sound now, so the
+	// following callback finds it in the cache
+	_sound->readAhead();
+}
+
+void IMuseDigital::getBundleCacheStats(uint32 &hits, uint32 &misses, uint32 &readAheads) {
+	Common::StackLock lock(_mutex, "IMuseDigital::getBundleCacheStats()");
+	_sound->getBundleCacheStats(hits, misses, readAheads);
 }
 
 void IMuseDigital::switchToNextRegion(Track *track) {
@@ -158,6 +158,7 @@ public:
 	int32 getCurVoiceLipSyncHeight();
 	int32 getCurMusicLipSyncWidth(int syncId);
 	int32 getCurMusicLipSyncHeight(int syncId);
+	void getBundleCacheStats(uint32 &hits, uint32 &misses, uint32 &readAheads);
 };
 
 } // End of namespace Scumm
@@ -148,6 +148,11 @@ BundleMgr::BundleMgr(BundleDirCache *cache) {
 	_fileBundleId = -1;
 	_file = new ScummFile();
 	_compInputBuff = NULL;
+	_useCounter = 0;
+	_cacheHits = 0;
+	_cacheMisses = 0;
+	_readAheads = 0;
+	flushBlockCache();
 }
 
 BundleMgr::~BundleMgr() {
@@ -192,8 +197,7 @@ bool BundleMgr::open(const char *filename, bool &compressed, bool errorFlag) {
 	_indexTable = _cache->getIndexTable(slot);
 	assert(_bundleTable);
 	_compTableLoaded = false;
-	_outputSize = 0;
-	_lastBlock = -1;
+	flushBlockCache();
 
 	return true;
 }
@@ -205,8 +209,7 @@ void BundleMgr::close() {
 		_numFiles = 0;
 		_numCompItems = 0;
 		_compTableLoaded = false;
-		_lastBlock = -1;
-		_outputSize = 0;
+		flushBlockCache();
 		_curSampleId = -1;
 		free(_compTable);
 		_compTable = NULL;
@@ -245,6 +248,61 @@ bool BundleMgr::loadCompTable(int32 index) {
 	return true;
 }
 
+void BundleMgr::flushBlockCache() {
+	for (int i = 0; i < kNumCachedBlocks; i++) {
+		_cachedBlocks[i].block = -1;
+		_cachedBlocks[i].size = 0;
+		_cachedBlocks[i].lastUse = 0;
+	}
+	_nextBlock = -1;
+}
+
+BundleMgr::CachedBlock *BundleMgr::findBlock(int32 block) {
+	for (int i = 0; i < kNumCachedBlocks; i++) {
+		if (_cachedBlocks[i].block == block)
+			return &_cachedBlocks[i];
+	}
+	return NULL;
+}
+
+BundleMgr::CachedBlock *BundleMgr::decodeBlock(int32 block) {
+	// Replace an unused or the least recently used block
+	CachedBlock *cached = &_cachedBlocks[0];
+	for (int i = 1; i < kNumCachedBlocks && cached->block != -1; i++) {
+		if (_cachedBlocks[i].block == -1 || _cachedBlocks[i].lastUse < cached->lastUse)
+			cached = &_cachedBlocks[i];
+	}
+
+	// CMI hack: one more zero byte at the end of input buffer
+	_compInputBuff[_compTable[block].size] = 0;
+	_file->seek(_bundleTable[_curSampleId].offset + _compTable[block].offset, SEEK_SET);
+	_file->read(_compInputBuff, _compTable[block].size);
+	cached->size = BundleCodecs::decompressCodec(_compTable[block].codec, _compInputBuff, cached->data, _compTable[block].size);
+	if (cached->size > kBlockSize) {
+		error("BundleMgr::decodeBlock() Decompressed block too big: %d", cached->size);
+	}
+	cached->block = block;
+	cached->lastUse = ++_useCounter;
+
+	return cached;
+}
+
+void BundleMgr::readAhead() {
+	if (!_compTableLoaded || _nextBlock < 0 || _nextBlock >= _numCompItems)
+		return;
+
+	if (!findBlock(_nextBlock)) {
+		decodeBlock(_nextBlock);
+		_readAheads++;
+	}
+}
+
+void BundleMgr::getCacheStats(uint32 &hits, uint32 &misses, uint32 &readAheads) const {
+	hits = _cacheHits;
+	misses = _cacheMisses;
+	readAheads = _readAheads;
+}
+
 int32 BundleMgr::decompressSampleByCurIndex(int32 offset, int32 size, byte **compFinal, int headerSize, bool headerOutside) {
 	return decompressSampleByIndex(_curSampleId, offset, size, compFinal, headerSize, headerOutside);
 }
@@ -286,19 +344,17 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 	skip = (offset + headerSize) % 0x2000;
 
 	for (i = firstBlock; i <= lastBlock; i++) {
-		if (_lastBlock != i) {
-			// CMI hack: one more zero byte at the end of input buffer
-			_compInputBuff[_compTable[i].size] = 0;
-			_file->seek(_bundleTable[index].offset + _compTable[i].offset, SEEK_SET);
-			_file->read(_compInputBuff, _compTable[i].size);
-			_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
-			if (_outputSize > 0x2000) {
-				error("_outputSize: %d", _outputSize);
-			}
-			_lastBlock = i;
+		CachedBlock *cached = findBlock(i);
+		if (cached) {
+			cached->lastUse = ++_useCounter;
+			_cacheHits++;
+		} else {
+			cached = decodeBlock(i);
+			_cacheMisses++;
 		}
+		_nextBlock = i + 1;
 
-		outputSize = _outputSize;
+		outputSize = cached->size;
 
 		if (headerOutside) {
 			outputSize -= skip;
@@ -315,7 +371,7 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 
 		assert(finalSize + outputSize <= blocksFinalSize);
 
-		memcpy(*compFinal + finalSize, _compOutputBuff + skip, outputSize);
+		memcpy(*compFinal + finalSize, cached->data + skip, outputSize);
 		finalSize += outputSize;
 
 		size -= outputSize;
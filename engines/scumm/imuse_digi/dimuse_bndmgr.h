@@ -73,6 +73,18 @@ private:
 		int32 codec;
 	};
 
+	enum {
+		kBlockSize = 0x2000,
+		kNumCachedBlocks = 4
+	};
+
+	struct CachedBlock {
+		int32 block;		// index into the comp table, -1 if unused
+		int32 size;			// decompressed size of the block
+		uint32 lastUse;		// for least recently used replacement
+		byte data[kBlockSize];
+	};
+
 	BundleDirCache *_cache;
 	BundleDirCache::AudioTable *_bundleTable;
 	BundleDirCache::IndexNode *_indexTable;
@@ -84,12 +96,19 @@ private:
 	BaseScummFile *_file;
 	bool _compTableLoaded;
 	int _fileBundleId;
-	byte _compOutputBuff[0x2000];
 	byte *_compInputBuff;
-	int _outputSize;
-	int _lastBlock;
+
+	CachedBlock _cachedBlocks[kNumCachedBlocks];
+	uint32 _useCounter;
+	int32 _nextBlock;	// block following the last request, read ahead candidate
+	uint32 _cacheHits;
+	uint32 _cacheMisses;
+	uint32 _readAheads;
 
 	bool loadCompTable(int32 index);
+	void flushBlockCache();
+	CachedBlock *findBlock(int32 block);
+	CachedBlock *decodeBlock(int32 block);
 
 public:
 
@@ -102,6 +121,10 @@ public:
 	int32 decompressSampleByName(const char *name, int32 offset, int32 size, byte **compFinal, bool headerOutside);
 	int32 decompressSampleByIndex(int32 index, int32 offset, int32 size, byte **compFinal, int header_size, bool headerOutside);
 	int32 decompressSampleByCurIndex(int32 offset, int32 size, byte **compFinal, int headerSize, bool headerOutside);
+
+	/** Decode the block following the last request, if it is not cached yet. */
+	void readAhead();
+	void getCacheStats(uint32 &hits, uint32 &misses, uint32 &readAheads) const;
 };
 
 } // End of namespace Scumm
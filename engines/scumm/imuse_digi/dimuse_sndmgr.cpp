@@ -46,6 +46,9 @@ ImuseDigiSndMgr::ImuseDigiSndMgr(ScummEngine *scumm) {
 	_disk = 0;
 	_cacheBundleDir = new BundleDirCache();
 	assert(_cacheBundleDir);
+	_bundleCacheHits = 0;
+	_bundleCacheMisses = 0;
+	_bundleReadAheads = 0;
 	BundleCodecs::initializeImcTables();
 }
 
@@ -482,7 +485,19 @@ void ImuseDigiSndMgr::closeSound(SoundDesc *soundDesc) {
 			_vm->_res->unlock(rtSound, soundDesc->soundId);
 	}
 
-	delete soundDesc->compressedStream;
+	if (soundDesc->bundle) {
+		uint32 hits, misses, readAheads;
+		soundDesc->bundle->getCacheStats(hits, misses, readAheads);
+		_bundleCacheHits += hits;
+		_bundleCacheMisses += misses;
+		_bundleReadAheads += readAheads;
+	}
+
+	if (soundDesc->compressedRegions) {
+		for (int r = 0; r < soundDesc->numRegions; r++)
+			delete soundDesc->compressedRegions[r].stream;
+		delete[] soundDesc->compressedRegions;
+	}
 	delete soundDesc->bundle;
 
 	for (int r = 0; r < soundDesc->numSyncs; r++)
@@ -632,6 +647,91 @@ int ImuseDigiSndMgr::getJumpFade(SoundDesc *soundDesc, int number) {
 	return soundDesc->jump[number].fadeDelay;
 }
 
+Audio::SeekableAudioStream *ImuseDigiSndMgr::openCompressedRegion(SoundDesc *soundDesc, int region) {
+	Audio::SeekableAudioStream *stream = NULL;
+	char fileName[24];
+	int32 offs = 0, len = 0;
+	Common::SeekableReadStream *cmpFile;
+	uint8 soundMode = 0;
+
+	sprintf(fileName, "%s_reg%03d.fla", soundDesc->name, region);
+	cmpFile = soundDesc->bundle->getFile(fileName, offs, len);
+	if (len) {
+#ifndef USE_FLAC
+		error("FLAC library compiled support needed");
+#endif
+		soundMode = 3;
+	}
+	if (!len) {
+		sprintf(fileName, "%s_reg%03d.ogg", soundDesc->name, region);
+		cmpFile = soundDesc->bundle->getFile(fileName, offs, len);
+		if (len) {
+#ifndef USE_VORBIS
+			error("Vorbis library compiled support needed");
+#endif
+			soundMode = 2;
+		}
+	}
+	if (!len) {
+		sprintf(fileName, "%s_reg%03d.mp3", soundDesc->name, region);
+		cmpFile = soundDesc->bundle->getFile(fileName, offs, len);
+		if (len) {
+#ifndef USE_MAD
+			error("Mad library compiled support needed");
+#endif
+			soundMode = 1;
+		}
+	}
+	assert(len);
+
+	Common::SeekableReadStream *tmp = cmpFile->readStream(len);
+	assert(tmp);
+#ifdef USE_FLAC
+	if (soundMode == 3)
+		stream = Audio::makeFLACStream(tmp, DisposeAfterUse::YES);
+#endif
+#ifdef USE_VORBIS
+	if (soundMode == 2)
+		stream = Audio::makeVorbisStream(tmp, DisposeAfterUse::YES);
+#endif
+#ifdef USE_MAD
+	if (soundMode == 1)
+		stream = Audio::makeMP3Stream(tmp, DisposeAfterUse::YES);
+#endif
+	assert(stream);
+	return stream;
+}
+
+ImuseDigiSndMgr::CompressedRegion &ImuseDigiSndMgr::getCompressedRegion(SoundDesc *soundDesc, int region) {
+	if (!soundDesc->compressedRegions)
+		soundDesc->compressedRegions = new CompressedRegion[soundDesc->numRegions]();
+
+	CompressedRegion &cmpRegion = soundDesc->compressedRegions[region];
+	if (!cmpRegion.stream) {
+		// Close the least recently used decoder if too many are open
+		int numOpen = 0;
+		CompressedRegion *oldest = NULL;
+		for (int r = 0; r < soundDesc->numRegions; r++) {
+			CompressedRegion &other = soundDesc->compressedRegions[r];
+			if (other.stream) {
+				numOpen++;
+				if (!oldest || other.lastUse < oldest->lastUse)
+					oldest = &other;
+			}
+		}
+		if (numOpen >= kMaxOpenCompressedRegions) {
+			delete oldest->stream;
+			oldest->stream = NULL;
+		}
+
+		cmpRegion.stream = openCompressedRegion(soundDesc, region);
+		cmpRegion.pos = 0;
+	}
+	cmpRegion.lastUse = ++soundDesc->compressedUse;
+
+	return cmpRegion;
+}
+
 int32 ImuseDigiSndMgr::getDataFromRegion(SoundDesc *soundDesc, int region, byte **buf, int32 offset, int32 size) {
 	debug(6, "getDataFromRegion() region:%d, offset:%d, size:%d, numRegions:%d", region, offset, size, soundDesc->numRegions);
 	assert(checkForProperHandle(soundDesc));
@@ -661,74 +761,46 @@ int32 ImuseDigiSndMgr::getDataFromRegion(SoundDesc *soundDesc, int region, byte
 	} else if ((soundDesc->bundle) && (soundDesc->compressed)) {
 		*buf = (byte *)malloc(size);
 		assert(*buf);
-		char fileName[24];
-		int offsetMs = (((offset * 8 * 10) / soundDesc->bits) / (soundDesc->channels * soundDesc->freq)) * 100;
-		sprintf(fileName, "%s_reg%03d", soundDesc->name, region);
-		if (scumm_stricmp(fileName, soundDesc->lastFileName) != 0) {
-			int32 offs = 0, len = 0;
-			Common::SeekableReadStream *cmpFile;
-			uint8 soundMode = 0;
-
-			sprintf(fileName, "%s_reg%03d.fla", soundDesc->name, region);
-			cmpFile = soundDesc->bundle->getFile(fileName, offs, len);
-			if (len) {
-#ifndef USE_FLAC
-				error("FLAC library compiled support needed");
-#endif
-				soundMode = 3;
-			}
-			if (!len) {
-				sprintf(fileName, "%s_reg%03d.ogg", soundDesc->name, region);
-				cmpFile = soundDesc->bundle->getFile(fileName, offs, len);
-				if (len) {
-#ifndef USE_VORBIS
-					error("Vorbis library compiled support needed");
-#endif
-					soundMode = 2;
-				}
-			}
-			if (!len) {
-				sprintf(fileName, "%s_reg%03d.mp3", soundDesc->name, region);
-				cmpFile = soundDesc->bundle->getFile(fileName, offs, len);
-				if (len) {
-#ifndef USE_MAD
-					error("Mad library compiled support needed");
-#endif
-					soundMode = 1;
-				}
-			}
-			assert(len);
 
-			if (!soundDesc->compressedStream) {
-				Common::SeekableReadStream *tmp = cmpFile->readStream(len);
-				assert(tmp);
-#ifdef USE_FLAC
-				if (soundMode == 3)
-					soundDesc->compressedStream = Audio::makeFLACStream(tmp, DisposeAfterUse::YES);
-#endif
-#ifdef USE_VORBIS
-				if (soundMode == 2)
-					soundDesc->compressedStream = Audio::makeVorbisStream(tmp, DisposeAfterUse::YES);
-#endif
-#ifdef USE_MAD
-				if (soundMode == 1)
-					soundDesc->compressedStream = Audio::makeMP3Stream(tmp, DisposeAfterUse::YES);
-#endif
-				assert(soundDesc->compressedStream);
-				soundDesc->compressedStream->seek(offsetMs);
-			}
-			strcpy(soundDesc->lastFileName, fileName);
+		CompressedRegion &cmpRegion = getCompressedRegion(soundDesc, region);
+
+		// Only seek when not simply continuing where the last read stopped,
+		// e.g. after a jump back to the start of a loop or for a fade track
+		if (offset != cmpRegion.pos) {
+			int32 frames = ((offset * 8) / soundDesc->bits) / soundDesc->channels;
+			cmpRegion.stream->seek(Audio::Timestamp(0, frames, soundDesc->freq));
 		}
-		size = soundDesc->compressedStream->readBuffer((int16 *)*buf, size / 2) * 2;
-		if (soundDesc->compressedStream->endOfData() || soundDesc->endFlag) {
-			delete soundDesc->compressedStream;
-			soundDesc->compressedStream = NULL;
-			soundDesc->lastFileName[0] = 0;
+
+		size = cmpRegion.stream->readBuffer((int16 *)*buf, size / 2) * 2;
+		cmpRegion.pos = offset + size;
+		if (cmpRegion.stream->endOfData())
 			soundDesc->endFlag = true;
-		}
 	}
 
 	return size;
 }
 
+void ImuseDigiSndMgr::readAhead() {
+	for (int l = 0; l < MAX_IMUSE_SOUNDS; l++) {
+		if (_sounds[l].inUse && _sounds[l].bundle && !_sounds[l].compressed)
+			_sounds[l].bundle->readAhead();
+	}
+}
+
+void ImuseDigiSndMgr::getBundleCacheStats(uint32 &hits, uint32 &misses, uint32 &readAheads) {
+	hits = _bundleCacheHits;
+	misses = _bundleCacheMisses;
+	readAheads = _bundleReadAheads;
+
+	for (int l = 0; l < MAX_IMUSE_SOUNDS; l++) {
+		if (_sounds[l].bundle) {
+			uint32 h, m, r;
+			_sounds[l].bundle->getCacheStats(h, m, r);
+			hits += h;
+			misses += m;
+			readAheads += r;
+		}
+	}
+}
+
 } // End of namespace Scumm
@@ -68,6 +68,16 @@ private:
 		char *ptr;			// pointer to string
 	};
 
+	struct CompressedRegion {
+		Audio::SeekableAudioStream *stream;	// decoder of the region's replacement file, if open
+		int32 pos;			// region offset the decoder is positioned at
+		uint32 lastUse;
+	};
+
+	// Number of decoders kept open per sound, so jumping between the
+	// regions of a music loop does not reopen the replacement files
+	enum { kMaxOpenCompressedRegions = 4 };
+
 public:
 
 	struct SoundDesc {
@@ -98,9 +108,9 @@ public:
 		int type;
 		int volGroupId;
 		int disk;
-		Audio::SeekableAudioStream *compressedStream;
+		CompressedRegion *compressedRegions;	// one per region, allocated on first use
+		uint32 compressedUse;
 		bool compressed;
-		char lastFileName[24];
 	};
 
 private:
@@ -116,11 +126,19 @@ private:
 	byte _disk;
 	BundleDirCache *_cacheBundleDir;
 
+	// Bundle block cache counters of already closed sounds
+	uint32 _bundleCacheHits;
+	uint32 _bundleCacheMisses;
+	uint32 _bundleReadAheads;
+
 	bool openMusicBundle(SoundDesc *sound, int &disk);
 	bool openVoiceBundle(SoundDesc *sound, int &disk);
 
 	void countElements(byte *ptr, int &numRegions, int &numJumps, int &numSyncs, int &numMarkers);
 
+	Audio::SeekableAudioStream *openCompressedRegion(SoundDesc *soundDesc, int region);
+	CompressedRegion &getCompressedRegion(SoundDesc *soundDesc, int region);
+
 public:
 
 	ImuseDigiSndMgr(ScummEngine *scumm);
@@ -146,6 +164,9 @@ public:
 	void getSyncSizeAndPtrById(SoundDesc *soundDesc, int number, int32 &sync_size, byte **sync_ptr);
 
 	int32 getDataFromRegion(SoundDesc *soundDesc, int region, byte **buf, int32 offset, int32 size);
+
+	void readAhead();
+	void getBundleCacheStats(uint32 &hits, uint32 &misses, uint32 &readAheads);
 };
 
 } // End of namespace Scumm
@@ -535,12 +535,15 @@ void ResourceManager::allocResTypeData(ResType type, uint32 tag, int num, ResTyp
 	if (num >= 8000)
 		error("Too many %s resources (%d) in directory", nameOfResType(type), num);
 
-	_types[type]._mode = mode;
-	_types[type]._tag = tag;
-
 	// If there was data in there, let's clear it out completely. This is important
 	// in case we are restarting the game.
+	for (ResId idx = 0; idx < _types[type].size(); idx++)
+		lruUnlink(type, idx);
 	_types[type].clear();
+
+	_types[type]._mode = mode;
+	_types[type]._tag = tag;
+
 	_types[type].resize(num);
 
 /*
@@ -687,6 +690,7 @@ int ScummEngine::loadResource(ResType type, ResId idx) {
 		_fileHandle->seek(-8, SEEK_CUR);
 	}
 	_fileHandle->read(_res->createResource(type, idx, size), size);
+	_res->_stats.loads++;
 
 	// dump the resource if requested
 	if (_dumpScripts && type == rtScript) {
@@ -746,7 +750,7 @@ byte *ScummEngine::getResourceAddress(ResType type, ResId idx) {
 		return NULL;
 	}
 
-	_res->setResourceCounter(type, idx, 1);
+	_res->touchResource(type, idx);
 
 	debugC(DEBUG_RESOURCE, "getResourceAddress(%s,%d) == %p", nameOfResType(type), idx, ptr);
 	return ptr;
@@ -801,6 +805,48 @@ byte ResourceManager::Resource::getResourceCounter() const {
 	return _flags & RF_USAGE;
 }
 
+void ResourceManager::touchResource(ResType type, ResId idx) {
+	setResourceCounter(type, idx, 1);
+
+	if (_types[type][idx]._inLru && _lruHead != makeKey(type, idx)) {
+		lruUnlink(type, idx);
+		lruLink(type, idx);
+	}
+}
+
+void ResourceManager::lruLink(ResType type, ResId idx) {
+	Resource &res = _types[type][idx];
+	const uint32 key = makeKey(type, idx);
+
+	res._lruPrev = RES_INVALID_OFFSET;
+	res._lruNext = _lruHead;
+	if (_lruHead != RES_INVALID_OFFSET)
+		getByKey(_lruHead)._lruPrev = key;
+	else
+		_lruTail = key;
+	_lruHead = key;
+	res._inLru = true;
+}
+
+void ResourceManager::lruUnlink(ResType type, ResId idx) {
+	Resource &res = _types[type][idx];
+	if (!res._inLru)
+		return;
+
+	if (res._lruPrev != RES_INVALID_OFFSET)
+		getByKey(res._lruPrev)._lruNext = res._lruNext;
+	else
+		_lruHead = res._lruNext;
+
+	if (res._lruNext != RES_INVALID_OFFSET)
+		getByKey(res._lruNext)._lruPrev = res._lruPrev;
+	else
+		_lruTail = res._lruPrev;
+
+	res._lruPrev = res._lruNext = RES_INVALID_OFFSET;
+	res._inLru = false;
+}
+
 /* 2 bytes safety area to make "precaching" of bytes in the gdi drawer easier */
 #define SAFETY_AREA 2
 
@@ -834,6 +880,11 @@ byte *ResourceManager::createResource(ResType type, ResId idx, uint32 size) {
 	_types[type][idx]._address = ptr;
 	_types[type][idx]._size = size;
 	setResourceCounter(type, idx, 1);
+
+	// Only resources which can be reloaded are candidates for expiring
+	if (_types[type]._mode != kDynamicResTypeMode)
+		lruLink(type, idx);
+
 	return ptr;
 }
 
@@ -844,6 +895,9 @@ ResourceManager::Resource::Resource() {
 	_status = 0;
 	_roomno = 0;
 	_roomoffs = 0;
+	_lruPrev = RES_INVALID_OFFSET;
+	_lruNext = RES_INVALID_OFFSET;
+	_inLru = false;
 }
 
 ResourceManager::Resource::~Resource() {
@@ -872,6 +926,9 @@ ResourceManager::ResourceManager(ScummEngine *vm) : _vm(vm) {
 	_maxHeapThreshold = 0;
 	_minHeapThreshold = 0;
 	_expireCounter = 0;
+	_lruHead = RES_INVALID_OFFSET;
+	_lruTail = RES_INVALID_OFFSET;
+	memset(&_stats, 0, sizeof(_stats));
 }
 
 ResourceManager::~ResourceManager() {
@@ -898,6 +955,7 @@ void ResourceManager::nukeResource(ResType type, ResId idx) {
 	if (ptr != NULL) {
 		debugC(DEBUG_RESOURCE, "nukeResource(%s,%d)", nameOfResType(type), idx);
 		_allocatedSize -= _types[type][idx]._size;
+		lruUnlink(type, idx);
 		_types[type][idx].nuke();
 	}
 }
@@ -1033,9 +1091,6 @@ void ResourceManager::Resource::setOnHeap() {
 }
 
 void ResourceManager::expireResources(uint32 size) {
-	byte best_counter;
-	ResType best_type;
-	int best_res = 0;
 	uint32 oldAllocatedSize;
 
 	if (_expireCounter != 0xFF) {
@@ -1048,31 +1103,22 @@ void ResourceManager::expireResources(uint32 size) {
 
 	oldAllocatedSize = _allocatedSize;
 
-	do {
-		best_type = rtInvalid;
-		best_counter = 2;
-
-		for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
-			if (_types[type]._mode != kDynamicResTypeMode) {
-				// Resources of this type can be reloaded from the data files,
-				// so we can potentially unload them to free memory.
-				ResId idx = _types[type].size();
-				while (idx-- > 0) {
-					Resource &tmp = _types[type][idx];
-					byte counter = tmp.getResourceCounter();
-					if (!tmp.isLocked() && counter >= best_counter && tmp._address && !_vm->isResourceInUse(type, idx) && !tmp.isOffHeap()) {
-						best_counter = counter;
-						best_type = type;
-						best_res = idx;
-					}
-				}
-			}
+	// Walk from the least recently used resource on. Only resources which
+	// were not used since the counters were last increased (counter >= 2)
+	// are thrown out, as pointers to the others may still be around.
+	uint32 key = _lruTail;
+	while (key != RES_INVALID_OFFSET && size + _allocatedSize > _minHeapThreshold) {
+		const ResType type = (ResType)(key >> 16);
+		const ResId idx = key & 0xFFFF;
+		Resource &tmp = _types[type][idx];
+		key = tmp._lruPrev;
+
+		if (!tmp.isLocked() && tmp.getResourceCounter() >= 2 && !_vm->isResourceInUse(type, idx) && !tmp.isOffHeap()) {
+			_stats.expired++;
+			_stats.expiredSize += tmp._size;
+			nukeResource(type, idx);
 		}
-
-		if (!best_type)
-			break;
-		nukeResource(best_type, best_res);
-	} while (size + _allocatedSize > _minHeapThreshold);
+	}
 
 	increaseResourceCounters();
 
@@ -1134,6 +1180,7 @@ void ResourceManager::resourceStats() {
 	}
 
 	debug(1, "Total allocated size=%d, locked=%d(%d)", _allocatedSize, lockedSize, lockedNum);
+	debug(1, "Loaded %d resources, expired %d (%d bytes)", _stats.loads, _stats.expired, _stats.expiredSize);
 }
 
 void ScummEngine_v5::readMAXS(int blockSize) {
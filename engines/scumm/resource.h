@@ -125,6 +125,13 @@ public:
 		 */
 		uint32 _roomoffs;
 
+		/**
+		 * Neighbours in the least recently used list of resources which can
+		 * be expired, as resource keys (see ResourceManager::makeKey()).
+		 */
+		uint32 _lruPrev, _lruNext;
+		bool _inLru;
+
 	public:
 		Resource();
 		~Resource();
@@ -175,11 +182,32 @@ protected:
 	uint32 _maxHeapThreshold, _minHeapThreshold;
 	byte _expireCounter;
 
+	/**
+	 * Least recently used list of all loaded resources that can be restored
+	 * from the data files. Head is the most, tail the least recently used.
+	 */
+	uint32 _lruHead, _lruTail;
+
+	static uint32 makeKey(ResType type, ResId idx) { return (type << 16) | idx; }
+	Resource &getByKey(uint32 key) { return _types[key >> 16][key & 0xFFFF]; }
+	void lruLink(ResType type, ResId idx);
+	void lruUnlink(ResType type, ResId idx);
+
+public:
+	/** Counters shown by the debugger's "resources" command. */
+	struct Stats {
+		uint32 loads;		///< resources loaded from the data files
+		uint32 expired;		///< resources thrown out to stay within the budget
+		uint32 expiredSize;
+	} _stats;
+
 public:
 	ResourceManager(ScummEngine *vm);
 	~ResourceManager();
 
 	void setHeapThreshold(int min, int max);
+	uint32 getAllocatedSize() const { return _allocatedSize; }
+	uint32 getMaxHeapThreshold() const { return _maxHeapThreshold; }
 
 	void allocResTypeData(ResType type, uint32 tag, int num, ResTypeMode mode);
 	void freeResources();
@@ -214,6 +242,12 @@ public:
 	 */
 	void setResourceCounter(ResType type, ResId idx, byte counter);
 
+	/**
+	 * Mark the resource as just used: reset its counter and move it to the
+	 * front of the least recently used list.
+	 */
+	void touchResource(ResType type, ResId idx);
+
 	/**
 	 * Increment the counter of all unlocked loaded resources.
 	 * The maximal count is 255.
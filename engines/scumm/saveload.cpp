@@ -1281,6 +1281,10 @@ void ScummEngine::saveOrLoad(Serializer *s) {
 			}
 	}
 
+	// The walkbox resources may have been replaced
+	if (s->isLoading())
+		invalidateBoxCache();
+
 
 	//
 	// Save/load global object state
@@ -21,6 +21,7 @@
  */
 
 #include "common/config-manager.h"
+#include "common/debug-channels.h"
 #include "common/util.h"
 #include "common/system.h"
 
@@ -458,6 +459,7 @@ void ScummEngine::refreshScriptPointer() {
 void ScummEngine::executeScript() {
 	int c;
 	while (_currentScript != 0xFF) {
+		const int script = vm.slot[_currentScript].number;
 
 		if (_showStack == 1) {
 			debugN("Stack:");
@@ -469,11 +471,14 @@ void ScummEngine::executeScript() {
 		_opcode = fetchScriptByte();
 		if (_game.version > 2) // V0-V2 games didn't use the didexec flag
 			vm.slot[_currentScript].didexec = true;
-		debugC(DEBUG_OPCODES, "Script %d, offset 0x%x: [%X] %s()",
-				vm.slot[_currentScript].number,
-				(uint)(_scriptPointer - _scriptOrgPointer),
-				_opcode,
-				getOpcodeDesc(_opcode));
+		// Check the channel first, so the arguments are not evaluated for
+		// every single opcode when tracing is off.
+		if (DebugMan.isDebugChannelEnabled(DEBUG_OPCODES))
+			debugC(DEBUG_OPCODES, "Script %d, offset 0x%x: [%X] %s()",
+					script,
+					(uint)(_scriptPointer - _scriptOrgPointer),
+					_opcode,
+					getOpcodeDesc(_opcode));
 		if (_hexdumpScripts == true) {
 			for (c = -1; c < 15; c++) {
 				debugN(" %02x", *(_scriptPointer + c));
@@ -481,8 +486,20 @@ void ScummEngine::executeScript() {
 			debugN("\n");
 		}
 
-		executeOpcode(_opcode);
-
+		if (_profileOpcodes) {
+			// Opcodes run much faster than the millisecond timer ticks, but
+			// the sum of the ticks seen while an opcode runs still averages
+			// out to the time spent in it. Opcodes which start other scripts
+			// include the time spent in those.
+			const byte opcode = _opcode;
+			const uint32 start = _system->getMillis();
+			executeOpcode(opcode);
+			OpcodeProfile &profile = _opcodeProfile[(script << 8) | opcode];
+			profile.count++;
+			profile.millis += _system->getMillis() - start;
+		} else {
+			executeOpcode(_opcode);
+		}
 	}
 }
 
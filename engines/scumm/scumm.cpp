@@ -35,6 +35,7 @@
 #include "graphics/cursorman.h"
 
 #include "scumm/akos.h"
+#include "scumm/boxes.h"
 #include "scumm/charset.h"
 #include "scumm/costume.h"
 #include "scumm/debugger.h"
@@ -301,6 +302,7 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 	_useTalkAnims = false;
 	_defaultTalkDelay = 0;
 	_saveSound = 0;
+	_boxCacheValid = false;
 	memset(_extraBoxFlags, 0, sizeof(_extraBoxFlags));
 	memset(_scaleSlots, 0, sizeof(_scaleSlots));
 	_charset = NULL;
@@ -531,6 +533,7 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 
 	_hexdumpScripts = false;
 	_showStack = false;
+	_profileOpcodes = false;
 
 	if (_game.platform == Common::kPlatformFMTowns && _game.version == 3) {	// FM-TOWNS V3 games use 320x240
 		_screenWidth = 320;
@@ -1312,7 +1315,26 @@ void ScummEngine::setupScumm() {
 		maxHeapThreshold = 550000;
 	}
 
-	_res->setHeapThreshold(400000, maxHeapThreshold);
+	int minHeapThreshold = 400000;
+
+	// Allow the user to raise (or lower) the resource budget, in kilobytes,
+	// so ports with plenty of memory can keep whole rooms' worth of data.
+	// The budget can't go below 550 KB, the traditional limit of the
+	// smallest games, as a room's resources have to fit at once.
+	if (ConfMan.hasKey("resource_budget")) {
+		int budget = ConfMan.getInt("resource_budget");
+		if (budget < 550) {
+			warning("resource_budget of %d KB is too small, using the minimum of 550 KB", budget);
+			budget = 550;
+		}
+		maxHeapThreshold = budget * 1024;
+
+		// With a custom budget, expiring frees only a quarter of it at once,
+		// but never goes below the traditional lower threshold.
+		minHeapThreshold = MAX(minHeapThreshold, maxHeapThreshold * 3 / 4);
+	}
+
+	_res->setHeapThreshold(minHeapThreshold, maxHeapThreshold);
 
 	free(_compositeBuf);
 	_compositeBuf = (byte *)malloc(_screenWidth * _textSurfaceMultiplier * _screenHeight * _textSurfaceMultiplier * _outputPixelFormat.bytesPerPixel);
@@ -28,6 +28,7 @@
 #include "common/endian.h"
 #include "common/events.h"
 #include "common/file.h"
+#include "common/hashmap.h"
 #include "common/savefile.h"
 #include "common/keyboard.h"
 #include "common/random.h"
@@ -587,6 +588,17 @@ protected:
 	bool _showStack;
 	uint16 _debugMode;
 
+	/** Statistics for one opcode of one script, see executeScript(). */
+	struct OpcodeProfile {
+		uint32 count;
+		uint32 millis;	///< including nested scripts
+		OpcodeProfile() : count(0), millis(0) {}
+	};
+	typedef Common::HashMap<uint32, OpcodeProfile> OpcodeProfileMap;
+	/** Opcode statistics, keyed by script number << 8 | opcode. */
+	OpcodeProfileMap _opcodeProfile;
+	bool _profileOpcodes;
+
 	// Save/Load class - some of this may be GUI
 	byte _saveLoadFlag, _saveLoadSlot;
 	uint32 _lastSaveTime;
@@ -1158,6 +1170,18 @@ protected:
 	void createBoxMatrix();
 	virtual bool areBoxesNeighbors(int i, int j);
 
+	// Walkbox coordinates and routes, decoded from the box resources on
+	// first use. Must be invalidated whenever the boxes or their flags change.
+	bool _boxCacheValid;
+	Common::Array<BoxCoords> _boxCoordsCache;
+	Common::Array<int16> _nextBoxCache;	// from * numBoxes + to, kNextBoxUnknown until computed
+	Common::Array<byte> _itineraryCache;	// shortest paths, only used by v0
+
+	void invalidateBoxCache();
+	void updateBoxCache();
+	BoxCoords readBoxCoordinates(int boxnum);
+	int findNextBox(byte from, byte to, int numOfBoxes);
+
 	/* String class */
 public:
 	CharsetRenderer *_charset;
@@ -24,6 +24,7 @@
 
 #include "common/config-manager.h"
 #include "common/file.h"
+#include "common/memstream.h"
 #include "common/system.h"
 #include "common/util.h"
 
@@ -241,6 +242,14 @@ SmushPlayer::SmushPlayer(ScummEngine_v7 *scumm) {
 	_paused = false;
 	_pauseStartTime = 0;
 	_pauseTime = 0;
+	_aheadFrame = NULL;
+	_aheadFrameSize = 0;
+	_aheadFramePos = -1;
+	_statFrames = 0;
+	_statFramesSkipped = 0;
+	_statFramesReadAhead = 0;
+	_statFrameTime = 0;
+	_statMaxFrameTime = 0;
 }
 
 SmushPlayer::~SmushPlayer() {
@@ -287,6 +296,8 @@ void SmushPlayer::release() {
 	delete _strings;
 	_strings = NULL;
 
+	freeAheadFrame();
+
 	delete _base;
 	_base = NULL;
 
@@ -1004,6 +1015,9 @@ void SmushPlayer::parseNextFrame() {
 			_skipPalette = true;
 		}
 
+		// Whatever was read ahead belongs to the old position
+		freeAheadFrame();
+
 		_base->seek(_seekPos + 8, SEEK_SET);
 		_frame = _seekFrame;
 		_startFrame = _frame;
@@ -1014,6 +1028,28 @@ void SmushPlayer::parseNextFrame() {
 
 	assert(_base);
 
+	if (_aheadFrame && _aheadFramePos == _base->pos()) {
+		Common::MemoryReadStream frame(_aheadFrame, _aheadFrameSize);
+		const uint32 startTime = _vm->_system->getMillis();
+
+		handleFrame(_aheadFrameSize, frame);
+
+		const uint32 frameTime = _vm->_system->getMillis() - startTime;
+		_statFrameTime += frameTime;
+		_statMaxFrameTime = MAX(_statMaxFrameTime, frameTime);
+		_statFramesReadAhead++;
+
+		_base->seek(_aheadFramePos + 8 + _aheadFrameSize, SEEK_SET);
+		freeAheadFrame();
+
+		if (_insanity)
+			_vm->_sound->processSound();
+
+		_vm->_imuseDigital->flushTracks();
+		return;
+	}
+	freeAheadFrame();
+
 	const uint32 subType = _base->readUint32BE();
 	const int32 subSize = _base->readUint32BE();
 	const int32 subOffset = _base->pos();
@@ -1030,9 +1066,16 @@ void SmushPlayer::parseNextFrame() {
 	case MKTAG('A','H','D','R'): // FT INSANE may seek file to the beginning
 		handleAnimHeader(subSize, *_base);
 		break;
-	case MKTAG('F','R','M','E'):
+	case MKTAG('F','R','M','E'): {
+		const uint32 startTime = _vm->_system->getMillis();
+
 		handleFrame(subSize, *_base);
+
+		const uint32 frameTime = _vm->_system->getMillis() - startTime;
+		_statFrameTime += frameTime;
+		_statMaxFrameTime = MAX(_statMaxFrameTime, frameTime);
 		break;
+	}
 	default:
 		error("Unknown Chunk found at %x: %s, %d", subOffset, tag2str(subType), subSize);
 	}
@@ -1045,6 +1088,44 @@ void SmushPlayer::parseNextFrame() {
 	_vm->_imuseDigital->flushTracks();
 }
 
+bool SmushPlayer::readAhead() {
+	// Only plain frames at the current position are read ahead. Seeks and
+	// the decoding itself still happen in parseNextFrame(), so the order of
+	// palette, sound, IACT and text chunks is unchanged.
+	if (_aheadFrame || !_base || _seekPos >= 0 || _endOfFile)
+		return false;
+
+	const int32 pos = _base->pos();
+	const uint32 subType = _base->readUint32BE();
+	const int32 subSize = _base->readUint32BE();
+
+	if (subType != MKTAG('F','R','M','E') || subSize <= 0 || _base->pos() >= (int32)_baseSize ||
+	    _base->pos() + subSize > (int32)_baseSize) {
+		_base->seek(pos, SEEK_SET);
+		return false;
+	}
+
+	_aheadFrame = (byte *)malloc(subSize);
+	assert(_aheadFrame);
+	if (_base->read(_aheadFrame, subSize) != (uint32)subSize) {
+		freeAheadFrame();
+		_base->seek(pos, SEEK_SET);
+		return false;
+	}
+
+	_aheadFrameSize = subSize;
+	_aheadFramePos = pos;
+	_base->seek(pos, SEEK_SET);
+	return true;
+}
+
+void SmushPlayer::freeAheadFrame() {
+	free(_aheadFrame);
+	_aheadFrame = NULL;
+	_aheadFrameSize = 0;
+	_aheadFramePos = -1;
+}
+
 void SmushPlayer::setPalette(const byte *palette) {
 	memcpy(_pal, palette, 0x300);
 	setDirtyColors(0, 255);
@@ -1173,6 +1254,12 @@ void SmushPlayer::play(const char *filename, int32 speed, int32 offset, int32 st
 
 	_pauseTime = 0;
 
+	_statFrames = 0;
+	_statFramesSkipped = 0;
+	_statFramesReadAhead = 0;
+	_statFrameTime = 0;
+	_statMaxFrameTime = 0;
+
 	int skipped = 0;
 
 	for (;;) {
@@ -1204,6 +1291,10 @@ void SmushPlayer::play(const char *filename, int32 speed, int32 offset, int32 st
 			else
 				skipFrame = false;
 			timerCallback();
+			_statFrames++;
+		} else {
+			// Use the time until the next frame is due to read it in
+			readAhead();
 		}
 
 		_vm->scummLoop_handleSound();
@@ -1238,6 +1329,8 @@ void SmushPlayer::play(const char *filename, int32 speed, int32 offset, int32 st
 				_vm->_system->copyRectToScreen(_dst, _width, 0, 0, w, h);
 				_vm->_system->updateScreen();
 				_updateNeeded = false;
+			} else {
+				_statFramesSkipped++;
 			}
 		}
 		if (_endOfFile)
@@ -1252,6 +1345,10 @@ void SmushPlayer::play(const char *filename, int32 speed, int32 offset, int32 st
 		_vm->_system->delayMillis(10);
 	}
 
+	debugC(DEBUG_SMUSH, "Smush stats: %d frames, %d skipped, %d read ahead, frame time avg %d ms, max %d ms",
+	       _statFrames, _statFramesSkipped, _statFramesReadAhead,
+	       _statFrames ? _statFrameTime / _statFrames : 0, _statMaxFrameTime);
+
 	release();
 
 	// Reset mouse state
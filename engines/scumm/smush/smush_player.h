@@ -82,6 +82,18 @@ private:
 	bool _middleAudio;
 	bool _skipPalette;
 
+	// Next FRME chunk, read while waiting for its presentation time
+	byte *_aheadFrame;
+	int32 _aheadFrameSize;
+	int32 _aheadFramePos;
+
+	// Frame timing statistics, reported at the end of play()
+	uint32 _statFrames;
+	uint32 _statFramesSkipped;
+	uint32 _statFramesReadAhead;
+	uint32 _statFrameTime;
+	uint32 _statMaxFrameTime;
+
 public:
 	SmushPlayer(ScummEngine_v7 *scumm);
 	~SmushPlayer();
@@ -111,6 +123,8 @@ protected:
 private:
 	SmushFont *getFont(int font);
 	void parseNextFrame();
+	bool readAhead();
+	void freeAheadFrame();
 	void init(int32 spped);
 	void setupAnim(const char *file);
 	void updateScreen();
@@ -293,6 +293,7 @@ bool AdLayer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 			stack->pushNative(entity, true);
 		}
 		_nodes.add(node);
+		BaseRegion::_changeCounter++;
 		return STATUS_OK;
 	}
 
@@ -328,6 +329,7 @@ bool AdLayer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 		} else {
 			_nodes.add(node);
 		}
+		BaseRegion::_changeCounter++;
 
 		return STATUS_OK;
 	}
@@ -367,6 +369,7 @@ bool AdLayer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 				break;
 			}
 		}
+		BaseRegion::_changeCounter++;
 		stack->pushBool(true);
 		return STATUS_OK;
 	} else {
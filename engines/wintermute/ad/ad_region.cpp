@@ -228,6 +228,7 @@ bool AdRegion::loadBuffer(byte *buffer, bool complete) {
 	}
 
 	createRegion();
+	_changeCounter++;
 
 	_alpha = BYTETORGBA(ar, ag, ab, alpha);
 
@@ -327,6 +328,7 @@ bool AdRegion::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	else if (strcmp(name, "Blocked") == 0) {
 		_blocked = value->getBool();
+		_changeCounter++;
 		return STATUS_OK;
 	}
 
@@ -335,6 +337,7 @@ bool AdRegion::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	else if (strcmp(name, "Decoration") == 0) {
 		_decoration = value->getBool();
+		_changeCounter++;
 		return STATUS_OK;
 	}
 
@@ -90,6 +90,12 @@ void AdScene::setDefaults() {
 	_mainLayer = nullptr;
 
 	_pfPointsNum = 0;
+	_pfOpenValid = false;
+
+	_blockGrid = nullptr;
+	_blockGridWidth = _blockGridHeight = 0;
+	_blockGridChangeCounter = 0;
+
 	_persistentState = false;
 	_persistentStateSprites = true;
 
@@ -175,6 +181,10 @@ void AdScene::cleanup() {
 	}
 	_pfPath.clear();
 	_pfPointsNum = 0;
+	_pfOpen.clear();
+	_pfOpenValid = false;
+
+	freeBlockGrid();
 
 	for (uint32 i = 0; i < _objects.size(); i++) {
 		_gameRef->unregisterObject(_objects[i]);
@@ -203,6 +213,7 @@ bool AdScene::getPath(BasePoint source, BasePoint target, AdPath *path, BaseObje
 
 		// prepare working path
 		pfPointsStart();
+		_pfOpenValid = false;
 
 		// first point
 		//_pfPath.add(new AdPathPoint(source.x, source.y, 0));
@@ -334,26 +345,46 @@ uint32 AdScene::getAlphaAt(int x, int y, bool colorCheck) {
 
 //////////////////////////////////////////////////////////////////////////
 bool AdScene::isBlockedAt(int x, int y, bool checkFreeObjects, BaseObject *requester) {
-	bool ret = true;
+	if (checkFreeObjects && isBlockedByObjectsAt(x, y, requester)) {
+		return true;
+	}
+	return isBlockedByRegionsAt(x, y);
+}
 
-	if (checkFreeObjects) {
-		for (uint32 i = 0; i < _objects.size(); i++) {
-			if (_objects[i]->_active && _objects[i] != requester && _objects[i]->_currentBlockRegion) {
-				if (_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
-					return true;
-				}
+
+//////////////////////////////////////////////////////////////////////////
+bool AdScene::isWalkableAt(int x, int y, bool checkFreeObjects, BaseObject *requester) {
+	if (checkFreeObjects && isBlockedByObjectsAt(x, y, requester)) {
+		return false;
+	}
+	return !isBlockedByRegionsAt(x, y);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool AdScene::isBlockedByObjectsAt(int x, int y, BaseObject *requester) {
+	for (uint32 i = 0; i < _objects.size(); i++) {
+		if (_objects[i]->_active && _objects[i] != requester && _objects[i]->_currentBlockRegion) {
+			if (_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
+				return true;
 			}
 		}
-		AdGame *adGame = (AdGame *)_gameRef;
-		for (uint32 i = 0; i < adGame->_objects.size(); i++) {
-			if (adGame->_objects[i]->_active && adGame->_objects[i] != requester && adGame->_objects[i]->_currentBlockRegion) {
-				if (adGame->_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
-					return true;
-				}
+	}
+	AdGame *adGame = (AdGame *)_gameRef;
+	for (uint32 i = 0; i < adGame->_objects.size(); i++) {
+		if (adGame->_objects[i]->_active && adGame->_objects[i] != requester && adGame->_objects[i]->_currentBlockRegion) {
+			if (adGame->_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
+				return true;
 			}
 		}
 	}
+	return false;
+}
+
 
+//////////////////////////////////////////////////////////////////////////
+bool AdScene::regionsBlockAt(int x, int y) {
+	bool ret = true;
 
 	if (_mainLayer) {
 		for (uint32 i = 0; i < _mainLayer->_nodes.size(); i++) {
@@ -380,42 +411,49 @@ bool AdScene::isBlockedAt(int x, int y, bool checkFreeObjects, BaseObject *reque
 
 
 //////////////////////////////////////////////////////////////////////////
-bool AdScene::isWalkableAt(int x, int y, bool checkFreeObjects, BaseObject *requester) {
-	bool ret = false;
+bool AdScene::isBlockedByRegionsAt(int x, int y) {
+	validateBlockGrid();
+	if (!_blockGrid || x < 0 || y < 0 || x >= _blockGridWidth || y >= _blockGridHeight) {
+		return regionsBlockAt(x, y);
+	}
 
-	if (checkFreeObjects) {
-		for (uint32 i = 0; i < _objects.size(); i++) {
-			if (_objects[i]->_active && _objects[i] != requester && _objects[i]->_currentBlockRegion) {
-				if (_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
-					return false;
-				}
-			}
-		}
-		AdGame *adGame = (AdGame *)_gameRef;
-		for (uint32 i = 0; i < adGame->_objects.size(); i++) {
-			if (adGame->_objects[i]->_active && adGame->_objects[i] != requester && adGame->_objects[i]->_currentBlockRegion) {
-				if (adGame->_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
-					return false;
-				}
-			}
-		}
+	byte &cell = _blockGrid[y * _blockGridWidth + x];
+	if (cell == kBlockUnknown) {
+		cell = regionsBlockAt(x, y) ? kBlockBlocked : kBlockWalkable;
 	}
+	return cell == kBlockBlocked;
+}
 
 
-	if (_mainLayer) {
-		for (uint32 i = 0; i < _mainLayer->_nodes.size(); i++) {
-			AdSceneNode *node = _mainLayer->_nodes[i];
-			if (node->_type == OBJECT_REGION && node->_region->_active && !node->_region->hasDecoration() && node->_region->pointInRegion(x, y)) {
-				if (node->_region->isBlocked()) {
-					ret = false;
-					break;
-				} else {
-					ret = true;
-				}
-			}
-		}
+//////////////////////////////////////////////////////////////////////////
+void AdScene::validateBlockGrid() {
+	if (!_mainLayer || _mainLayer->_width <= 0 || _mainLayer->_height <= 0) {
+		freeBlockGrid();
+		return;
 	}
-	return ret;
+
+	if (_blockGrid && _blockGridChangeCounter == BaseRegion::_changeCounter &&
+	        _blockGridWidth == _mainLayer->_width && _blockGridHeight == _mainLayer->_height) {
+		return;
+	}
+
+	if (!_blockGrid || _blockGridWidth != _mainLayer->_width || _blockGridHeight != _mainLayer->_height) {
+		freeBlockGrid();
+		_blockGridWidth = _mainLayer->_width;
+		_blockGridHeight = _mainLayer->_height;
+		_blockGrid = new byte[_blockGridWidth * _blockGridHeight];
+	}
+	memset(_blockGrid, kBlockUnknown, _blockGridWidth * _blockGridHeight);
+	_blockGridChangeCounter = BaseRegion::_changeCounter;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void AdScene::freeBlockGrid() {
+	delete[] _blockGrid;
+	_blockGrid = nullptr;
+	_blockGridWidth = _blockGridHeight = 0;
+	_blockGridChangeCounter = 0;
 }
 
 
@@ -433,6 +471,29 @@ int AdScene::getPointsDist(BasePoint p1, BasePoint p2, BaseObject *requester) {
 	xLength = abs(x2 - x1);
 	yLength = abs(y2 - y1);
 
+	// only the block regions of free objects near the line need to be checked
+	// for every pixel; the scene regions come from the block grid
+	int minX = MIN(x1, x2) - 1, maxX = MAX(x1, x2) + 1;
+	int minY = MIN(y1, y2) - 1, maxY = MAX(y1, y2) + 1;
+	_blockObjectRegions.clear();
+	for (uint32 i = 0; i < _objects.size(); i++) {
+		if (_objects[i]->_active && _objects[i] != requester && _objects[i]->_currentBlockRegion) {
+			const Rect32 &rect = _objects[i]->_currentBlockRegion->_rect;
+			if (rect.left <= maxX && rect.right >= minX && rect.top <= maxY && rect.bottom >= minY) {
+				_blockObjectRegions.push_back(_objects[i]->_currentBlockRegion);
+			}
+		}
+	}
+	AdGame *adGame = (AdGame *)_gameRef;
+	for (uint32 i = 0; i < adGame->_objects.size(); i++) {
+		if (adGame->_objects[i]->_active && adGame->_objects[i] != requester && adGame->_objects[i]->_currentBlockRegion) {
+			const Rect32 &rect = adGame->_objects[i]->_currentBlockRegion->_rect;
+			if (rect.left <= maxX && rect.right >= minX && rect.top <= maxY && rect.bottom >= minY) {
+				_blockObjectRegions.push_back(adGame->_objects[i]->_currentBlockRegion);
+			}
+		}
+	}
+
 	if (xLength > yLength) {
 		if (x1 > x2) {
 			BaseUtils::swap(&x1, &x2);
@@ -443,9 +504,14 @@ int AdScene::getPointsDist(BasePoint p1, BasePoint p2, BaseObject *requester) {
 		y = y1;
 
 		for (xCount = x1; xCount < x2; xCount++) {
-			if (isBlockedAt(xCount, (int)y, true, requester)) {
+			if (isBlockedByRegionsAt(xCount, (int)y)) {
 				return -1;
 			}
+			for (uint32 i = 0; i < _blockObjectRegions.size(); i++) {
+				if (_blockObjectRegions[i]->pointInRegion(xCount, (int)y)) {
+					return -1;
+				}
+			}
 			y += yStep;
 		}
 	} else {
@@ -458,9 +524,14 @@ int AdScene::getPointsDist(BasePoint p1, BasePoint p2, BaseObject *requester) {
 		x = x1;
 
 		for (yCount = y1; yCount < y2; yCount++) {
-			if (isBlockedAt((int)x, yCount, true, requester)) {
+			if (isBlockedByRegionsAt((int)x, yCount)) {
 				return -1;
 			}
+			for (uint32 i = 0; i < _blockObjectRegions.size(); i++) {
+				if (_blockObjectRegions[i]->pointInRegion((int)x, yCount)) {
+					return -1;
+				}
+			}
 			x += xStep;
 		}
 	}
@@ -470,16 +541,21 @@ int AdScene::getPointsDist(BasePoint p1, BasePoint p2, BaseObject *requester) {
 
 //////////////////////////////////////////////////////////////////////////
 void AdScene::pathFinderStep() {
-	int i;
-	// get lowest unmarked
-	int lowestDist = INT_MAX;
-	AdPathPoint *lowestPt = nullptr;
+	if (!_pfOpenValid) {
+		pfOpenRebuild();
+	}
 
-	for (i = 0; i < _pfPointsNum; i++)
-		if (!_pfPath[i]->_marked && _pfPath[i]->_distance < lowestDist) {
-			lowestDist = _pfPath[i]->_distance;
-			lowestPt = _pfPath[i];
+	// get lowest unmarked, skipping queue entries that were superseded
+	// by a shorter distance later on
+	AdPathPoint *lowestPt = nullptr;
+	PathFinderNode node;
+	while (pfOpenPop(node)) {
+		AdPathPoint *pt = _pfPath[node.index];
+		if (!pt->_marked && pt->_distance == node.distance) {
+			lowestPt = pt;
+			break;
 		}
+	}
 
 	if (lowestPt == nullptr) { // no path -> terminate PathFinder
 		_pfReady = true;
@@ -502,14 +578,109 @@ void AdScene::pathFinderStep() {
 	}
 
 	// otherwise keep on searching
-	for (i = 0; i < _pfPointsNum; i++)
-		if (!_pfPath[i]->_marked) {
-			int j = getPointsDist(*lowestPt, *_pfPath[i], _pfRequester);
-			if (j != -1 && lowestPt->_distance + j < _pfPath[i]->_distance) {
-				_pfPath[i]->_distance = lowestPt->_distance + j;
-				_pfPath[i]->_origin = lowestPt;
-			}
+	for (int i = 0; i < _pfPointsNum; i++) {
+		AdPathPoint *pt = _pfPath[i];
+		if (pt->_marked) {
+			continue;
+		}
+
+		// getPointsDist() is either -1 or this, so only walk the line
+		// if it could actually shorten the path to the point
+		int dist = MAX(abs(pt->x - lowestPt->x), abs(pt->y - lowestPt->y));
+		if (lowestPt->_distance + dist >= pt->_distance) {
+			continue;
+		}
+
+		if (getPointsDist(*lowestPt, *pt, _pfRequester) != -1) {
+			pt->_distance = lowestPt->_distance + dist;
+			pt->_origin = lowestPt;
+			pfOpenPush(i);
 		}
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+int AdScene::pfEstimate(int index) const {
+	// straight-line distance as measured by getPointsDist(), so it never
+	// overestimates and the first path reaching the target is the shortest
+	const AdPathPoint *pt = _pfPath[index];
+	return pt->_distance + MAX(abs(pt->x - _pfTarget->x), abs(pt->y - _pfTarget->y));
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void AdScene::pfOpenRebuild() {
+	_pfOpen.clear();
+	for (int i = 0; i < _pfPointsNum; i++) {
+		if (!_pfPath[i]->_marked && _pfPath[i]->_distance < INT_MAX) {
+			pfOpenPush(i);
+		}
+	}
+	_pfOpenValid = true;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+static inline bool pfNodeLess(int estimateA, int indexA, int estimateB, int indexB) {
+	return estimateA < estimateB || (estimateA == estimateB && indexA < indexB);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void AdScene::pfOpenPush(int index) {
+	PathFinderNode node;
+	node.estimate = pfEstimate(index);
+	node.distance = _pfPath[index]->_distance;
+	node.index = index;
+
+	// sift up
+	uint pos = _pfOpen.size();
+	_pfOpen.push_back(node);
+	while (pos > 0) {
+		uint parent = (pos - 1) / 2;
+		if (!pfNodeLess(node.estimate, node.index, _pfOpen[parent].estimate, _pfOpen[parent].index)) {
+			break;
+		}
+		_pfOpen[pos] = _pfOpen[parent];
+		pos = parent;
+	}
+	_pfOpen[pos] = node;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool AdScene::pfOpenPop(PathFinderNode &node) {
+	if (_pfOpen.empty()) {
+		return false;
+	}
+
+	node = _pfOpen[0];
+	PathFinderNode last = _pfOpen.back();
+	_pfOpen.pop_back();
+	uint size = _pfOpen.size();
+	if (size == 0) {
+		return true;
+	}
+
+	// sift down
+	uint pos = 0;
+	for (;;) {
+		uint child = pos * 2 + 1;
+		if (child >= size) {
+			break;
+		}
+		if (child + 1 < size && pfNodeLess(_pfOpen[child + 1].estimate, _pfOpen[child + 1].index, _pfOpen[child].estimate, _pfOpen[child].index)) {
+			child++;
+		}
+		if (!pfNodeLess(_pfOpen[child].estimate, _pfOpen[child].index, last.estimate, last.index)) {
+			break;
+		}
+		_pfOpen[pos] = _pfOpen[child];
+		pos = child;
+	}
+	_pfOpen[pos] = last;
+	return true;
 }
 
 
@@ -2339,6 +2510,13 @@ bool AdScene::persist(BasePersistenceManager *persistMgr) {
 	persistMgr->transfer(TMEMBER(_pfRequester));
 	persistMgr->transfer(TMEMBER(_pfTarget));
 	persistMgr->transfer(TMEMBER(_pfTargetPath));
+	_pfOpen.clear();
+	_pfOpenValid = false;
+	if (!persistMgr->getIsSaving()) {
+		_blockGrid = nullptr;
+		_blockGridWidth = _blockGridHeight = 0;
+		_blockGridChangeCounter = 0;
+	}
 	_rotLevels.persist(persistMgr);
 	_scaleLevels.persist(persistMgr);
 	persistMgr->transfer(TMEMBER(_scrollPixelsH));
@@ -2712,6 +2890,7 @@ bool AdScene::persistState(bool saving) {
 						nodeState->_active = node->_region->_active;
 					} else {
 						node->_region->_active = nodeState->_active;
+						BaseRegion::_changeCounter++;
 					}
 				}
 				break;
@@ -36,6 +36,7 @@ namespace Wintermute {
 class UIWindow;
 class AdObject;
 class AdRegion;
+class BaseRegion;
 class BaseViewport;
 class AdLayer;
 class BasePoint;
@@ -171,6 +172,38 @@ private:
 	BaseObject *_pfRequester;
 	BaseArray<AdPathPoint *> _pfPath;
 
+	// Open set of the A* search over _pfPath, rebuilt from the points
+	// after getPath() and after loading, so it is never persisted
+	struct PathFinderNode {
+		int estimate;	// distance so far plus the remaining straight-line distance
+		int distance;	// distance of the point when it was queued
+		int index;		// index into _pfPath
+	};
+	Common::Array<PathFinderNode> _pfOpen;
+	bool _pfOpenValid;
+	void pfOpenRebuild();
+	void pfOpenPush(int index);
+	bool pfOpenPop(PathFinderNode &node);
+	int pfEstimate(int index) const;
+
+	// Region part of isBlockedAt(), rasterized lazily over the main layer
+	// and thrown away whenever BaseRegion::_changeCounter moves on
+	enum {
+		kBlockUnknown = 0,
+		kBlockWalkable = 1,
+		kBlockBlocked = 2
+	};
+	byte *_blockGrid;
+	int _blockGridWidth;
+	int _blockGridHeight;
+	uint32 _blockGridChangeCounter;
+	Common::Array<BaseRegion *> _blockObjectRegions;
+	void validateBlockGrid();
+	void freeBlockGrid();
+	bool regionsBlockAt(int x, int y);
+	bool isBlockedByRegionsAt(int x, int y);
+	bool isBlockedByObjectsAt(int x, int y, BaseObject *requester);
+
 	int _offsetTop;
 	int _offsetLeft;
 
@@ -80,6 +80,7 @@ bool BaseFileManager::cleanup() {
 	_openFiles.clear();
 
 	// delete packages
+	_packageFiles.clear();
 	_packages.clear();
 
 	// get rid of the resources:
@@ -225,9 +226,26 @@ bool BaseFileManager::registerPackages() {
 }
 
 bool BaseFileManager::registerPackage(Common::FSNode file, const Common::String &filename, bool searchSignature) {
+	if (_packages.hasArchive(file.getName())) {
+		warning("BaseFileManager::registerPackage: package '%s' already registered", file.getName().c_str());
+		return STATUS_OK;
+	}
 	PackageSet *pack = new PackageSet(file, filename, searchSignature);
 	_packages.add(file.getName(), pack, pack->getPriority() , true);
 
+	// Merge the package into the file index. Like in the SearchSet, an
+	// entry is only replaced by one from a package of higher priority.
+	Common::ArchiveMemberList members;
+	pack->listMembers(members);
+	for (Common::ArchiveMemberList::iterator it = members.begin(); it != members.end(); ++it) {
+		PackageFileMap::iterator fileIt = _packageFiles.find((*it)->getName());
+		if (fileIt == _packageFiles.end() || fileIt->_value._priority < pack->getPriority()) {
+			PackageFile &packageFile = _packageFiles[(*it)->getName()];
+			packageFile._entry = *it;
+			packageFile._priority = pack->getPriority();
+		}
+	}
+
 	return STATUS_OK;
 }
 
@@ -245,24 +263,19 @@ void BaseFileManager::initResources() {
 
 //////////////////////////////////////////////////////////////////////////
 Common::SeekableReadStream *BaseFileManager::openPkgFile(const Common::String &filename) {
-	Common::String upcName = filename;
-	upcName.toUppercase();
-	Common::SeekableReadStream *file = nullptr;
-	char fileName[MAX_PATH_LENGTH];
-	strcpy(fileName, upcName.c_str());
+	Common::String pkgName = filename;
 
 	// correct slashes
-	for (uint32 i = 0; i < upcName.size(); i++) {
-		if (upcName[(int32)i] == '/') {
-			upcName.setChar('\\', (uint32)i);
+	for (uint32 i = 0; i < pkgName.size(); i++) {
+		if (pkgName[(int32)i] == '/') {
+			pkgName.setChar('\\', (uint32)i);
 		}
 	}
-	Common::ArchiveMemberPtr entry = _packages.getMember(upcName);
-	if (!entry) {
+	PackageFileMap::iterator it = _packageFiles.find(pkgName);
+	if (it == _packageFiles.end()) {
 		return nullptr;
 	}
-	file = entry->createReadStream();
-	return file;
+	return it->_value._entry->createReadStream();
 }
 
 bool BaseFileManager::hasFile(const Common::String &filename) {
@@ -277,7 +290,7 @@ bool BaseFileManager::hasFile(const Common::String &filename) {
 	if (diskFileExists(filename)) {
 		return true;
 	}
-	if (_packages.hasFile(filename)) {
+	if (_packageFiles.contains(filename)) {
 		return true;    // We don't bother checking if the file can actually be opened, something bigger is wrong if that is the case.
 	}
 	if (!_detectionMode && _resources->hasFile(filename)) {
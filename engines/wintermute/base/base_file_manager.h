@@ -33,6 +33,7 @@
 #include "common/str.h"
 #include "common/fs.h"
 #include "common/file.h"
+#include "common/hashmap.h"
 #include "common/language.h"
 
 namespace Wintermute {
@@ -67,6 +68,14 @@ private:
 	bool registerPackage(Common::FSNode package, const Common::String &filename = "", bool searchSignature = false);
 	bool _detectionMode;
 	Common::SearchSet _packages;
+	// Entries of all registered packages, by name, so a lookup doesn't
+	// have to ask every package in turn
+	struct PackageFile {
+		Common::ArchiveMemberPtr _entry;
+		int _priority;
+	};
+	typedef Common::HashMap<Common::String, PackageFile, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> PackageFileMap;
+	PackageFileMap _packageFiles;
 	Common::Array<Common::SeekableReadStream *> _openFiles;
 	Common::Language _language;
 	Common::Archive *_resources;
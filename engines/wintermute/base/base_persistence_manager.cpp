@@ -55,6 +55,55 @@ namespace Wintermute {
 // avoid those numbers, and use this instead:
 #define SAVE_MAGIC_3    0x12564154
 
+// Collects the savegame in fixed size chunks. MemoryWriteStreamDynamic
+// grows its buffer a few bytes at a time, which made saving a large game
+// quadratic in its size.
+class SaveChunkStream : public Common::WriteStream {
+public:
+	SaveChunkStream() : _size(0), _chunkPos(kChunkSize) {}
+
+	~SaveChunkStream() {
+		for (uint i = 0; i < _chunks.size(); i++) {
+			delete[] _chunks[i];
+		}
+	}
+
+	uint32 write(const void *dataPtr, uint32 dataSize) {
+		const byte *data = (const byte *)dataPtr;
+		uint32 left = dataSize;
+		while (left > 0) {
+			if (_chunkPos == kChunkSize) {
+				_chunks.push_back(new byte[kChunkSize]);
+				_chunkPos = 0;
+			}
+			uint32 len = MIN<uint32>(left, kChunkSize - _chunkPos);
+			memcpy(_chunks.back() + _chunkPos, data, len);
+			_chunkPos += len;
+			data += len;
+			left -= len;
+		}
+		_size += dataSize;
+		return dataSize;
+	}
+
+	uint32 size() const {
+		return _size;
+	}
+
+	void writeTo(Common::WriteStream *stream) const {
+		for (uint i = 0; i < _chunks.size(); i++) {
+			stream->write(_chunks[i], (i + 1 < _chunks.size()) ? (uint32)kChunkSize : _chunkPos);
+		}
+	}
+
+private:
+	enum { kChunkSize = 256 * 1024 };
+
+	Common::Array<byte *> _chunks;
+	uint32 _size;
+	uint32 _chunkPos;
+};
+
 //////////////////////////////////////////////////////////////////////////
 BasePersistenceManager::BasePersistenceManager(const char *savePrefix, bool deleteSingleton) {
 	_saving = false;
@@ -213,7 +262,7 @@ bool BasePersistenceManager::initSave(const char *desc) {
 	cleanup();
 	_saving = true;
 
-	_saveStream = new Common::MemoryWriteStreamDynamic(DisposeAfterUse::YES);
+	_saveStream = new SaveChunkStream();
 
 	if (_saveStream) {
 		// get thumbnails
@@ -409,13 +458,14 @@ bool BasePersistenceManager::initLoad(const Common::String &filename) {
 bool BasePersistenceManager::saveFile(const Common::String &filename) {
 	byte *prefixBuffer = _richBuffer;
 	uint32 prefixSize = _richBufferSize;
-	byte *buffer = ((Common::MemoryWriteStreamDynamic *)_saveStream)->getData();
-	uint32 bufferSize = ((Common::MemoryWriteStreamDynamic *)_saveStream)->size();
 
 	Common::SaveFileManager *saveMan = ((WintermuteEngine *)g_engine)->getSaveFileMan();
 	Common::OutSaveFile *file = saveMan->openForSaving(filename);
+	if (!file) {
+		return STATUS_FAILED;
+	}
 	file->write(prefixBuffer, prefixSize);
-	file->write(buffer, bufferSize);
+	((SaveChunkStream *)_saveStream)->writeTo(file);
 	bool retVal = !file->err();
 	file->finalize();
 	delete file;
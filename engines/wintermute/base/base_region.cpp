@@ -41,6 +41,8 @@ namespace Wintermute {
 
 IMPLEMENT_PERSISTENT(BaseRegion, false)
 
+uint32 BaseRegion::_changeCounter = 0;
+
 //////////////////////////////////////////////////////////////////////////
 BaseRegion::BaseRegion(BaseGame *inGame) : BaseObject(inGame) {
 	_active = true;
@@ -55,6 +57,7 @@ BaseRegion::BaseRegion(BaseGame *inGame) : BaseObject(inGame) {
 //////////////////////////////////////////////////////////////////////////
 BaseRegion::~BaseRegion() {
 	cleanup();
+	_changeCounter++;
 }
 
 
@@ -211,6 +214,7 @@ bool BaseRegion::loadBuffer(byte *buffer, bool complete) {
 	}
 
 	createRegion();
+	_changeCounter++;
 
 	return STATUS_OK;
 }
@@ -231,6 +235,7 @@ bool BaseRegion::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 
 		_points.add(new BasePoint(x, y));
 		createRegion();
+		_changeCounter++;
 
 		stack->pushBool(true);
 
@@ -249,6 +254,7 @@ bool BaseRegion::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 		if (index >= 0 && index < (int32)_points.size()) {
 			_points.insert_at(index, new BasePoint(x, y));
 			createRegion();
+			_changeCounter++;
 
 			stack->pushBool(true);
 		} else {
@@ -271,6 +277,7 @@ bool BaseRegion::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 			_points[index]->x = x;
 			_points[index]->y = y;
 			createRegion();
+			_changeCounter++;
 
 			stack->pushBool(true);
 		} else {
@@ -293,6 +300,7 @@ bool BaseRegion::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 
 			_points.remove_at(index);
 			createRegion();
+			_changeCounter++;
 
 			stack->pushBool(true);
 		} else {
@@ -381,6 +389,7 @@ bool BaseRegion::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	else if (strcmp(name, "Active") == 0) {
 		_active = value->getBool();
+		_changeCounter++;
 		return STATUS_OK;
 	} else {
 		return BaseObject::scSetProperty(name, value);
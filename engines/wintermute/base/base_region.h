@@ -59,6 +59,10 @@ public:
 	virtual bool scSetProperty(const char *name, ScValue *value);
 	virtual bool scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name);
 	virtual const char *scToString();
+
+	// Bumped by every change that can alter which points a region covers
+	// or blocks, so cached walkability (see AdScene) knows it went stale
+	static uint32 _changeCounter;
 private:
 	float _lastMimicScale;
 	int _lastMimicX;
@@ -30,6 +30,7 @@
 #include "engines/wintermute/base/file/base_file_entry.h"
 #include "engines/wintermute/base/file/dcpackage.h"
 #include "engines/wintermute/wintermute.h"
+#include "common/bufferedstream.h"
 #include "common/file.h"
 #include "common/stream.h"
 #include "common/debug.h"
@@ -104,7 +105,8 @@ PackageSet::PackageSet(Common::FSNode file, const Common::String &filename, bool
 	uint32 absoluteOffset = 0;
 	_priority = 0;
 	bool boundToExe = false;
-	Common::SeekableReadStream *stream = file.createReadStream();
+	// The directory is parsed with lots of small reads, buffer them
+	Common::SeekableReadStream *stream = Common::wrapBufferedSeekableReadStream(file.createReadStream(), 64 * 1024, DisposeAfterUse::YES);
 	if (!stream) {
 		return;
 	}
@@ -150,14 +152,13 @@ PackageSet::PackageSet(Common::FSNode file, const Common::String &filename, bool
 		pkg->_boundToExe = boundToExe;
 
 		// read package info
+		char name[256];
 		byte nameLength = stream->readByte();
-		char *pkgName = new char[nameLength];
-		stream->read(pkgName, nameLength);
-		pkg->_name = pkgName;
+		stream->read(name, nameLength);
+		name[nameLength] = '\0';
+		pkg->_name = name;
 		pkg->_cd = stream->readByte();
 		pkg->_priority = hdr._priority;
-		delete[] pkgName;
-		pkgName = nullptr;
 
 		if (!hdr._masterIndex) {
 			pkg->_cd = 0;    // override CD to fixed disk
@@ -168,11 +169,9 @@ PackageSet::PackageSet(Common::FSNode file, const Common::String &filename, bool
 		uint32 numFiles = stream->readUint32LE();
 
 		for (uint32 j = 0; j < numFiles; j++) {
-			char *name;
 			uint32 offset, length, compLength, flags;/*, timeDate1, timeDate2;*/
 
 			nameLength = stream->readByte();
-			name = new char[nameLength];
 			stream->read(name, nameLength);
 
 			// v2 - xor name
@@ -181,12 +180,11 @@ PackageSet::PackageSet(Common::FSNode file, const Common::String &filename, bool
 					((byte *)name)[k] ^= 'D';
 				}
 			}
+			name[nameLength] = '\0';
 			debugC(kWintermuteDebugFileAccess, "Package contains %s", name);
 
 			Common::String upcName = name;
 			upcName.toUppercase();
-			delete[] name;
-			name = nullptr;
 
 			offset = stream->readUint32LE();
 			offset += absoluteOffset;
@@ -201,6 +199,7 @@ PackageSet::PackageSet(Common::FSNode file, const Common::String &filename, bool
 			_filesIter = _files.find(upcName);
 			if (_filesIter == _files.end()) {
 				BaseFileEntry *fileEntry = new BaseFileEntry();
+				fileEntry->_filename = upcName;
 				fileEntry->_package = pkg;
 				fileEntry->_offset = offset;
 				fileEntry->_length = length;
@@ -259,6 +258,9 @@ const Common::ArchiveMemberPtr PackageSet::getMember(const Common::String &name)
 	upcName.toUppercase();
 	Common::HashMap<Common::String, Common::ArchiveMemberPtr>::const_iterator it;
 	it = _files.find(upcName.c_str());
+	if (it == _files.end()) {
+		return Common::ArchiveMemberPtr();
+	}
 	return Common::ArchiveMemberPtr(it->_value);
 }
 
@@ -55,9 +55,7 @@ BaseFontTT::BaseFontTT(BaseGame *inGame) : BaseFont(inGame) {
 	_fallbackFont = nullptr;
 	_deletableFont = nullptr;
 
-	for (int i = 0; i < NUM_CACHED_TEXTS; i++) {
-		_cachedTexts[i] = nullptr;
-	}
+	_cachedTextsSize = 0;
 
 	_lineHeight = 0;
 	_maxCharWidth = _maxCharHeight = 0;
@@ -82,12 +80,22 @@ BaseFontTT::~BaseFontTT(void) {
 
 //////////////////////////////////////////////////////////////////////////
 void BaseFontTT::clearCache() {
-	for (int i = 0; i < NUM_CACHED_TEXTS; i++) {
-		if (_cachedTexts[i]) {
-			delete _cachedTexts[i];
-		}
-		_cachedTexts[i] = nullptr;
+	for (CachedTextList::iterator it = _cachedTexts.begin(); it != _cachedTexts.end(); ++it) {
+		delete *it;
 	}
+	_cachedTexts.clear();
+	_cachedTextIndex.clear();
+	_cachedTextsSize = 0;
+
+	_cachedMeasures.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////
+void BaseFontTT::removeCachedText(CachedTextList::iterator it) {
+	_cachedTextIndex.erase((*it)->_key);
+	_cachedTextsSize -= (*it)->_size;
+	delete *it;
+	_cachedTexts.erase(it);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -95,17 +103,16 @@ void BaseFontTT::initLoop() {
 	// we need more aggressive cache management on iOS not to waste too much memory on fonts
 	if (_gameRef->_constrainedMemory) {
 		// purge all cached images not used in the last frame
-		for (int i = 0; i < NUM_CACHED_TEXTS; i++) {
-			if (_cachedTexts[i] == nullptr) {
-				continue;
-			}
-
-			if (!_cachedTexts[i]->_marked) {
-				delete _cachedTexts[i];
-				_cachedTexts[i] = nullptr;
+		CachedTextList::iterator it = _cachedTexts.begin();
+		while (it != _cachedTexts.end()) {
+			CachedTextList::iterator next = it;
+			++next;
+			if (!(*it)->_marked) {
+				removeCachedText(it);
 			} else {
-				_cachedTexts[i]->_marked = false;
+				(*it)->_marked = false;
 			}
+			it = next;
 		}
 	}
 }
@@ -174,28 +181,24 @@ void BaseFontTT::drawText(const byte *text, int x, int y, int width, TTextAlign
 	BaseRenderer *renderer = _gameRef->_renderer;
 
 	// find cached surface, if exists
-	uint32 minUseTime = UINT_MAX;
-	int minIndex = -1;
 	BaseSurface *surface = nullptr;
 	int textOffset = 0;
 
-	for (int i = 0; i < NUM_CACHED_TEXTS; i++) {
-		if (_cachedTexts[i] == nullptr) {
-			minUseTime = 0;
-			minIndex = i;
-		} else {
-			if (_cachedTexts[i]->_text == textStr && _cachedTexts[i]->_align == align && _cachedTexts[i]->_width == width && _cachedTexts[i]->_maxHeight == maxHeight && _cachedTexts[i]->_maxLength == maxLength) {
-				surface = _cachedTexts[i]->_surface;
-				textOffset = _cachedTexts[i]->_textOffset;
-				_cachedTexts[i]->_marked = true;
-				_cachedTexts[i]->_lastUsed = g_system->getMillis();
-				break;
-			} else {
-				if (_cachedTexts[i]->_lastUsed < minUseTime) {
-					minUseTime = _cachedTexts[i]->_lastUsed;
-					minIndex = i;
-				}
-			}
+	Common::String key = Common::String::format("%d:%d:%d:%d:", align, width, maxHeight, maxLength) + textStr;
+	Common::HashMap<Common::String, CachedTextList::iterator>::iterator indexIt = _cachedTextIndex.find(key);
+	if (indexIt != _cachedTextIndex.end()) {
+		CachedTextList::iterator it = indexIt->_value;
+		BaseCachedTTFontText *cachedText = *it;
+		surface = cachedText->_surface;
+		textOffset = cachedText->_textOffset;
+		cachedText->_marked = true;
+		cachedText->_lastUsed = g_system->getMillis();
+
+		// move to the front of the list
+		if (it != _cachedTexts.begin()) {
+			_cachedTexts.erase(it);
+			_cachedTexts.push_front(cachedText);
+			indexIt->_value = _cachedTexts.begin();
 		}
 	}
 
@@ -204,21 +207,31 @@ void BaseFontTT::drawText(const byte *text, int x, int y, int width, TTextAlign
 		debugC(kWintermuteDebugFont, "Draw text: %s", text);
 		surface = renderTextToTexture(textStr, width, align, maxHeight, textOffset);
 		if (surface) {
-			// write surface to cache
-			if (_cachedTexts[minIndex] != nullptr) {
-				delete _cachedTexts[minIndex];
+			BaseCachedTTFontText *cachedText = new BaseCachedTTFontText;
+			cachedText->_key = key;
+			cachedText->_surface = surface;
+			cachedText->_align = align;
+			cachedText->_width = width;
+			cachedText->_maxHeight = maxHeight;
+			cachedText->_maxLength = maxLength;
+			cachedText->_text = textStr;
+			cachedText->_textOffset = textOffset;
+			cachedText->_marked = true;
+			cachedText->_lastUsed = g_system->getMillis();
+			cachedText->_size = surface->getWidth() * surface->getHeight() * 4;
+
+			// make room, dropping the least recently used texts
+			while (!_cachedTexts.empty() &&
+			        (_cachedTexts.size() >= NUM_CACHED_TEXTS || _cachedTextsSize + cachedText->_size > MAX_CACHED_TEXTS_SIZE)) {
+				CachedTextList::iterator last = _cachedTexts.end();
+				--last;
+				removeCachedText(last);
 			}
-			_cachedTexts[minIndex] = new BaseCachedTTFontText;
-
-			_cachedTexts[minIndex]->_surface = surface;
-			_cachedTexts[minIndex]->_align = align;
-			_cachedTexts[minIndex]->_width = width;
-			_cachedTexts[minIndex]->_maxHeight = maxHeight;
-			_cachedTexts[minIndex]->_maxLength = maxLength;
-			_cachedTexts[minIndex]->_text = textStr;
-			_cachedTexts[minIndex]->_textOffset = textOffset;
-			_cachedTexts[minIndex]->_marked = true;
-			_cachedTexts[minIndex]->_lastUsed = g_system->getMillis();
+
+			// write surface to cache
+			_cachedTexts.push_front(cachedText);
+			_cachedTextIndex[key] = _cachedTexts.begin();
+			_cachedTextsSize += cachedText->_size;
 		}
 	}
 
@@ -284,12 +297,16 @@ BaseSurface *BaseFontTT::renderTextToTexture(const WideString &text, int width,
 	}
 
 	BaseSurface *retSurface = _gameRef->_renderer->createSurface();
-	Graphics::Surface *convertedSurface = surface->convertTo(Graphics::PixelFormat(4, 8, 8, 8, 8, 16, 8, 0, 24));
-	retSurface->putSurface(*convertedSurface, true);
-	convertedSurface->free();
+	if (_deletableFont) { // already in the texture format
+		retSurface->putSurface(*surface, true);
+	} else {
+		Graphics::Surface *convertedSurface = surface->convertTo(Graphics::PixelFormat(4, 8, 8, 8, 8, 16, 8, 0, 24));
+		retSurface->putSurface(*convertedSurface, true);
+		convertedSurface->free();
+		delete convertedSurface;
+	}
 	surface->free();
 	delete surface;
-	delete convertedSurface;
 	return retSurface;
 	// TODO: _isUnderline, _isBold, _isItalic, _isStriked
 }
@@ -527,9 +544,7 @@ bool BaseFontTT::persist(BasePersistenceManager *persistMgr) {
 	}
 
 	if (!persistMgr->getIsSaving()) {
-		for (int i = 0; i < NUM_CACHED_TEXTS; i++) {
-			_cachedTexts[i] = nullptr;
-		}
+		_cachedTextsSize = 0;
 		_fallbackFont = _font = _deletableFont = nullptr;
 	}
 
@@ -598,6 +613,7 @@ bool BaseFontTT::initFont() {
 		warning("BaseFontTT::InitFont - Couldn't load font: %s", _fontFile);
 	}
 	_lineHeight = _font->getFontHeight();
+	_cachedMeasures.clear();
 	return STATUS_OK;
 }
 
@@ -605,6 +621,15 @@ bool BaseFontTT::initFont() {
 void BaseFontTT::measureText(const WideString &text, int maxWidth, int maxHeight, int &textWidth, int &textHeight) {
 	//TextLineList lines;
 
+	// UI code measures the same texts every frame, word wrapping is not cheap
+	Common::String key = Common::String::format("%d:", maxWidth) + text;
+	Common::HashMap<Common::String, TextMeasure>::iterator measureIt = _cachedMeasures.find(key);
+	if (measureIt != _cachedMeasures.end()) {
+		textWidth = measureIt->_value.width;
+		textHeight = measureIt->_value.height;
+		return;
+	}
+
 	if (maxWidth >= 0) {
 		Common::Array<Common::String> lines;
 		_font->wordWrapText(text, maxWidth, lines);
@@ -629,6 +654,13 @@ void BaseFontTT::measureText(const WideString &text, int maxWidth, int maxHeight
 	        delete line;
 	        line = nullptr;
 	    }*/
+
+	if (_cachedMeasures.size() >= NUM_CACHED_MEASURES) {
+		_cachedMeasures.clear();
+	}
+	TextMeasure &measure = _cachedMeasures[key];
+	measure.width = textWidth;
+	measure.height = textHeight;
 }
 
 } // end of namespace Wintermute
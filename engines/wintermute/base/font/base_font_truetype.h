@@ -35,8 +35,13 @@
 #include "common/rect.h"
 #include "graphics/surface.h"
 #include "graphics/font.h"
+#include "common/list.h"
 
-#define NUM_CACHED_TEXTS 30
+// Rendered texts are kept until either limit is reached
+#define NUM_CACHED_TEXTS 100
+#define MAX_CACHED_TEXTS_SIZE (8 * 1024 * 1024)
+// Measured texts, the whole table is dropped when it fills up
+#define NUM_CACHED_MEASURES 256
 
 namespace Wintermute {
 
@@ -45,6 +50,7 @@ private:
 	//////////////////////////////////////////////////////////////////////////
 	class BaseCachedTTFontText {
 	public:
+		Common::String _key;
 		WideString _text;
 		int _width;
 		TTextAlign _align;
@@ -55,6 +61,7 @@ private:
 		int _textOffset;
 		bool _marked;
 		uint32 _lastUsed;
+		uint32 _size;
 
 		BaseCachedTTFontText() {
 			//_text = L"";
@@ -65,6 +72,7 @@ private:
 			_textOffset = 0;
 			_lastUsed = 0;
 			_marked = false;
+			_size = 0;
 		}
 
 		virtual ~BaseCachedTTFontText() {
@@ -122,7 +130,18 @@ private:
 
 	BaseSurface *renderTextToTexture(const WideString &text, int width, TTextAlign align, int maxHeight, int &textOffset);
 
-	BaseCachedTTFontText *_cachedTexts[NUM_CACHED_TEXTS];
+	// Most recently used first, with a hash index over the cache keys
+	typedef Common::List<BaseCachedTTFontText *> CachedTextList;
+	CachedTextList _cachedTexts;
+	Common::HashMap<Common::String, CachedTextList::iterator> _cachedTextIndex;
+	uint32 _cachedTextsSize;
+	void removeCachedText(CachedTextList::iterator it);
+
+	struct TextMeasure {
+		int width;
+		int height;
+	};
+	Common::HashMap<Common::String, TextMeasure> _cachedMeasures;
 
 	bool initFont();
 
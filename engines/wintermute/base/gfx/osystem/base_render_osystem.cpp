@@ -34,6 +34,7 @@
 #include "engines/wintermute/math/math_util.h"
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/base_sprite.h"
+#include "engines/wintermute/wintermute.h"
 #include "common/system.h"
 #include "engines/wintermute/graphics/transparent_surface.h"
 #include "common/queue.h"
@@ -55,12 +56,13 @@ BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
 	_batchNum = 0;
 	_skipThisFrame = false;
 	_previousTicket = nullptr;
+	_nextTicket = _renderQueue.end();
+	memset(&_ticketStats, 0, sizeof(_ticketStats));
 
 	_borderLeft = _borderRight = _borderTop = _borderBottom = 0;
 	_ratioX = _ratioY = 1.0f;
 	setAlphaMod(255);
 	setColorMod(255, 255, 255);
-	_dirtyRect = nullptr;
 	_disableDirtyRects = false;
 	if (ConfMan.hasKey("dirty_rects")) {
 		_disableDirtyRects = !ConfMan.getBool("dirty_rects");
@@ -71,13 +73,9 @@ BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
 BaseRenderOSystem::~BaseRenderOSystem() {
 	RenderQueueIterator it = _renderQueue.begin();
 	while (it != _renderQueue.end()) {
-		RenderTicket *ticket = *it;
-		it = _renderQueue.erase(it);
-		delete ticket;
+		it = removeTicket(it);
 	}
 
-	delete _dirtyRect;
-
 	_renderSurface->free();
 	delete _renderSurface;
 	_blankSurface->free();
@@ -168,11 +166,10 @@ bool BaseRenderOSystem::indicatorFlip() {
 bool BaseRenderOSystem::flip() {
 	if (_skipThisFrame) {
 		_skipThisFrame = false;
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		_dirtyRects.clear();
 		g_system->updateScreen();
 		_needsFlip = false;
-		_drawNum = 1;
+		startFrame();
 		addDirtyRect(_renderRect);
 		return true;
 	}
@@ -183,11 +180,8 @@ bool BaseRenderOSystem::flip() {
 		RenderQueueIterator it = _renderQueue.begin();
 		while (it != _renderQueue.end()) {
 			if ((*it)->_wantsDraw == false) {
-				RenderTicket *ticket = *it;
-				it = _renderQueue.erase(it);
-				delete ticket;
+				it = removeTicket(it);
 			} else {
-				(*it)->_wantsDraw = false;
 				++it;
 			}
 		}
@@ -197,16 +191,97 @@ bool BaseRenderOSystem::flip() {
 			g_system->copyRectToScreen((byte *)_renderSurface->pixels, _renderSurface->pitch, 0, 0, _renderSurface->w, _renderSurface->h);
 		}
 		//  g_system->copyRectToScreen((byte *)_renderSurface->pixels, _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		_dirtyRects.clear();
 		g_system->updateScreen();
 		_needsFlip = false;
 	}
-	_drawNum = 1;
+
+	debugC(kWintermuteDebugRender, "Render queue: %d tickets, %d reused, %d moved, %d added, %d removed, %d redrawn",
+	       _renderQueue.size(), _ticketStats.reused, _ticketStats.moved, _ticketStats.added, _ticketStats.removed, _ticketStats.redrawn);
+	memset(&_ticketStats, 0, sizeof(_ticketStats));
+
+	startFrame();
 
 	return STATUS_OK;
 }
 
+/**
+ * Get the queue ready for the next frame: no ticket has been drawn yet,
+ * and the draw numbers follow the queue order again.
+ */
+void BaseRenderOSystem::startFrame() {
+	_drawNum = 1;
+	for (RenderQueueIterator it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+		(*it)->_drawNum = _drawNum++;
+		(*it)->_wantsDraw = false;
+	}
+	_drawNum = 1;
+	_nextTicket = _renderQueue.begin();
+}
+
+void BaseRenderOSystem::queueTicket(RenderQueueIterator pos, RenderTicket *ticket) {
+	_renderQueue.insert(pos, ticket);
+	ticket->_queuePos = --pos;
+	_ticketIndex[ticket->getHash()].push_back(ticket);
+	_ticketStats.added++;
+}
+
+BaseRenderOSystem::RenderQueueIterator BaseRenderOSystem::removeTicket(RenderQueueIterator it) {
+	RenderTicket *ticket = *it;
+
+	RenderTicketIndex::iterator bucket = _ticketIndex.find(ticket->getHash());
+	assert(bucket != _ticketIndex.end());
+	Common::Array<RenderTicket *> &tickets = bucket->_value;
+	for (uint i = 0; i < tickets.size(); i++) {
+		if (tickets[i] == ticket) {
+			tickets.remove_at(i);
+			break;
+		}
+	}
+	if (tickets.empty()) {
+		_ticketIndex.erase(bucket);
+	}
+
+	if (_nextTicket == it) {
+		++_nextTicket;
+	}
+	if (_previousTicket == ticket) {
+		_previousTicket = nullptr;
+	}
+	_ticketStats.removed++;
+
+	it = _renderQueue.erase(it);
+	delete ticket;
+	return it;
+}
+
+/**
+ * Look for a queued ticket identical to compare, which can be drawn again
+ * instead of creating a new one. Of several candidates, the one queued
+ * first is returned, as walking the queue would have found.
+ */
+RenderTicket *BaseRenderOSystem::findReusableTicket(RenderTicket &compare) {
+	RenderTicketIndex::iterator bucket = _ticketIndex.find(compare.getHash());
+	if (bucket == _ticketIndex.end()) {
+		return nullptr;
+	}
+
+	RenderTicket *found = nullptr;
+	Common::Array<RenderTicket *> &tickets = bucket->_value;
+	for (uint i = 0; i < tickets.size(); i++) {
+		RenderTicket *ticket = tickets[i];
+		// Tickets already drawn this frame are taken, unless there is no
+		// order to keep, without dirty rects.
+		if (!ticket->_isValid || (ticket->_wantsDraw && !_disableDirtyRects) || !(*ticket == compare)) {
+			continue;
+		}
+		if (!found || ticket->_drawNum < found->_drawNum) {
+			found = ticket;
+		}
+	}
+	return found;
+}
+
 //////////////////////////////////////////////////////////////////////////
 bool BaseRenderOSystem::fill(byte r, byte g, byte b, Common::Rect *rect) {
 	_clearColor = _renderSurface->format.ARGBToColor(0xFF, r, g, b);
@@ -277,12 +352,6 @@ Graphics::PixelFormat BaseRenderOSystem::getPixelFormat() const {
 }
 
 void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, bool mirrorX, bool mirrorY, bool disableAlpha) {
-	// Start searching from the beginning for the first and second items (since it's empty the first time around
-	// then keep incrementing the start-position, to avoid comparing against already used tickets.
-	if (_drawNum == 0 || _drawNum == 1) {
-		_lastAddedTicket = _renderQueue.begin();
-	}
-
 	// Skip rects that are completely outside the screen:
 	if ((dstRect->left < 0 && dstRect->right < 0) || (dstRect->top < 0 && dstRect->bottom < 0)) {
 		return;
@@ -295,23 +364,16 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 			_batchNum++;
 		}
 		compare._colorMod = _colorMod;
-		RenderQueueIterator it;
-		// Avoid calling end() and operator* every time, when potentially going through
-		// LOTS of tickets.
-		RenderQueueIterator endIterator = _renderQueue.end();
-		RenderTicket *compareTicket = nullptr;
-		for (it = _lastAddedTicket; it != endIterator; ++it) {
-			compareTicket = *it;
-			if (*(compareTicket) == compare && compareTicket->_isValid) {
-				compareTicket->_colorMod = _colorMod;
-				if (_disableDirtyRects) {
-					drawFromSurface(compareTicket);
-				} else {
-					drawFromTicket(compareTicket);
-					_previousTicket = compareTicket;
-				}
-				return;
+		RenderTicket *compareTicket = findReusableTicket(compare);
+		if (compareTicket) {
+			compareTicket->_colorMod = _colorMod;
+			if (_disableDirtyRects) {
+				drawFromSurface(compareTicket);
+			} else {
+				drawFromTicket(compareTicket);
+				_previousTicket = compareTicket;
 			}
+			return;
 		}
 	}
 	RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, mirrorX, mirrorY, disableAlpha);
@@ -321,25 +383,14 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 		_previousTicket = ticket;
 	} else {
 		ticket->_wantsDraw = true;
-		_renderQueue.push_back(ticket);
+		queueTicket(_renderQueue.end(), ticket);
 	}
 }
 
 void BaseRenderOSystem::repeatLastDraw(int offsetX, int offsetY, int numTimesX, int numTimesY) {
-	if (_previousTicket && _lastAddedTicket != _renderQueue.end()) {
+	if (_previousTicket) {
 		RenderTicket *origTicket = _previousTicket;
 
-		// Make sure drawSurface WILL start from the correct _lastAddedTicket
-		if (*_lastAddedTicket != origTicket) {
-			RenderQueueIterator it;
-			RenderQueueIterator endIterator = _renderQueue.end();
-			for (it = _renderQueue.begin(); it != endIterator; ++it) {
-				if ((*it) == _previousTicket) {
-					_lastAddedTicket = it;
-					break;
-				}
-			}
-		}
 		Common::Rect srcRect(0, 0, 0, 0);
 		srcRect.setWidth(origTicket->getSrcRect()->width());
 		srcRect.setHeight(origTicket->getSrcRect()->height());
@@ -382,69 +433,65 @@ void BaseRenderOSystem::invalidateTicketsFromSurface(BaseSurfaceOSystem *surf) {
 
 void BaseRenderOSystem::drawFromTicket(RenderTicket *renderTicket) {
 	renderTicket->_wantsDraw = true;
+	_drawNum++;
 	// A new item always has _drawNum == 0
 	if (renderTicket->_drawNum == 0) {
-		// In-order
-		if (_renderQueue.empty() || _drawNum > (_renderQueue.back())->_drawNum) {
-			renderTicket->_drawNum = _drawNum++;
-			_renderQueue.push_back(renderTicket);
-			addDirtyRect(renderTicket->_dstRect);
-			++_lastAddedTicket;
-		} else {
-			// Before something
-			RenderQueueIterator pos;
-			for (pos = _renderQueue.begin(); pos != _renderQueue.end(); pos++) {
-				if ((*pos)->_drawNum >= _drawNum) {
-					break;
-				}
-			}
-			_renderQueue.insert(pos, renderTicket);
-			renderTicket->_drawNum = _drawNum++;
-			// Increment the following tickets, so they still are in line
-			RenderQueueIterator it;
-			for (it = pos; it != _renderQueue.end(); ++it) {
-				(*it)->_drawNum++;
-				(*it)->_wantsDraw = false;
-			}
-			addDirtyRect(renderTicket->_dstRect);
-			_lastAddedTicket = pos;
-		}
-	} else {
+		// Goes in front of the tickets not drawn yet
+		renderTicket->_drawNum = _drawNum;
+		queueTicket(_nextTicket, renderTicket);
+		addDirtyRect(renderTicket->_dstRect);
+	} else if (_nextTicket != _renderQueue.end() && *_nextTicket == renderTicket) {
 		// Was drawn last round, still in the same order
-		if (_drawNum == renderTicket->_drawNum) {
-			_drawNum++;
-			++_lastAddedTicket;
-		} else {
-			// Remove the ticket from the list
-			RenderQueueIterator it = _renderQueue.begin();
-			while (it != _renderQueue.end()) {
-				if ((*it) == renderTicket) {
-					it = _renderQueue.erase(it);
-					break;
-				} else {
-					++it;
-				}
-			}
-			if (it != _renderQueue.end()) {
-				// Decreement the following tickets.
-				for (; it != _renderQueue.end(); ++it) {
-					(*it)->_drawNum--;
-				}
-			}
-			// Is not in order, so readd it as if it was a new ticket
-			renderTicket->_drawNum = 0;
-			drawFromTicket(renderTicket);
-		}
+		++_nextTicket;
+		_ticketStats.reused++;
+	} else {
+		// Is not in order, so move it in front of the tickets not drawn yet
+		_renderQueue.erase(renderTicket->_queuePos);
+		_renderQueue.insert(_nextTicket, renderTicket);
+		renderTicket->_queuePos = _nextTicket;
+		--renderTicket->_queuePos;
+		addDirtyRect(renderTicket->_dstRect);
+		_ticketStats.moved++;
+	}
+}
+
+// Whether it is cheaper to redraw the bounding rect of a and b than both on their own
+static bool shouldMergeDirtyRects(const Common::Rect &a, const Common::Rect &b) {
+	if (a.intersects(b)) {
+		return true;
 	}
+	Common::Rect merged(a);
+	merged.extend(b);
+	return merged.width() * merged.height() <= a.width() * a.height() + b.width() * b.height();
 }
 
 void BaseRenderOSystem::addDirtyRect(const Common::Rect &rect) {
-	if (!_dirtyRect) {
-		_dirtyRect = new Common::Rect(rect);
-	} else {
-		_dirtyRect->extend(rect);
+	Common::Rect dirty(rect);
+	dirty.clip(_renderRect);
+	if (dirty.isEmpty()) {
+		return;
+	}
+
+	// Swallow all rects it overlaps, including those only the grown
+	// rect reaches.
+	uint i = 0;
+	while (i < _dirtyRects.size()) {
+		if (shouldMergeDirtyRects(_dirtyRects[i], dirty)) {
+			dirty.extend(_dirtyRects[i]);
+			_dirtyRects.remove_at(i);
+			i = 0;
+		} else {
+			i++;
+		}
+	}
+	_dirtyRects.push_back(dirty);
+
+	if (_dirtyRects.size() > kMaxDirtyRects) {
+		for (i = 1; i < _dirtyRects.size(); i++) {
+			_dirtyRects[0].extend(_dirtyRects[i]);
+		}
+		_dirtyRects.resize(1);
 	}
-	_dirtyRect->clip(_renderRect);
 }
 
 void BaseRenderOSystem::drawTickets() {
@@ -453,74 +500,60 @@ void BaseRenderOSystem::drawTickets() {
 	// Note: We draw invalid tickets too, otherwise we wouldn't be honouring
 	// the draw request they obviously made BEFORE becoming invalid, either way
 	// we have a copy of their data, so their invalidness won't affect us.
-	uint32 decrement = 0;
 	while (it != _renderQueue.end()) {
 		if ((*it)->_wantsDraw == false) {
-			RenderTicket *ticket = *it;
 			addDirtyRect((*it)->_dstRect);
-			it = _renderQueue.erase(it);
-			delete ticket;
-			decrement++;
+			it = removeTicket(it);
 		} else {
-			(*it)->_drawNum -= decrement;
 			++it;
 		}
 	}
-	if (!_dirtyRect || _dirtyRect->width() == 0 || _dirtyRect->height() == 0) {
-		it = _renderQueue.begin();
-		while (it != _renderQueue.end()) {
-			RenderTicket *ticket = *it;
-			ticket->_wantsDraw = false;
-			++it;
-		}
+	if (_dirtyRects.empty()) {
 		return;
 	}
 	// The color-mods are stored in the RenderTickets on add, since we set that state again during
 	// draw, we need to keep track of what it was prior to draw.
 	uint32 oldColorMod = _colorMod;
 
-	// Apply the clear-color to the dirty rect.
-	_renderSurface->fillRect(*_dirtyRect, _clearColor);
-	_drawNum = 1;
-	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
-		RenderTicket *ticket = *it;
-		assert(ticket->_drawNum == _drawNum++);
-		if (ticket->_dstRect.intersects(*_dirtyRect)) {
-			// dstClip is the area we want redrawn.
-			Common::Rect dstClip(ticket->_dstRect);
-			// reduce it to the dirty rect
-			dstClip.clip(*_dirtyRect);
-			// we need to keep track of the position to redraw the dirty rect
-			Common::Rect pos(dstClip);
-			int16 offsetX = ticket->_dstRect.left;
-			int16 offsetY = ticket->_dstRect.top;
-			// convert from screen-coords to surface-coords.
-			dstClip.translate(-offsetX, -offsetY);
-
-			_colorMod = ticket->_colorMod;
-			drawFromSurface(ticket, &pos, &dstClip);
-			_needsFlip = true;
+	// Redraw each dirty rect on its own, and only push those to the backend.
+	for (uint i = 0; i < _dirtyRects.size(); i++) {
+		const Common::Rect &dirtyRect = _dirtyRects[i];
+
+		// Apply the clear-color to the dirty rect.
+		_renderSurface->fillRect(dirtyRect, _clearColor);
+		for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+			RenderTicket *ticket = *it;
+			if (ticket->_dstRect.intersects(dirtyRect)) {
+				// dstClip is the area we want redrawn.
+				Common::Rect dstClip(ticket->_dstRect);
+				// reduce it to the dirty rect
+				dstClip.clip(dirtyRect);
+				// we need to keep track of the position to redraw the dirty rect
+				Common::Rect pos(dstClip);
+				int16 offsetX = ticket->_dstRect.left;
+				int16 offsetY = ticket->_dstRect.top;
+				// convert from screen-coords to surface-coords.
+				dstClip.translate(-offsetX, -offsetY);
+
+				_colorMod = ticket->_colorMod;
+				drawFromSurface(ticket, &pos, &dstClip);
+				_needsFlip = true;
+				_ticketStats.redrawn++;
+			}
 		}
-		// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldnt become clear-color)
-		ticket->_wantsDraw = false;
+		g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(dirtyRect.left, dirtyRect.top), _renderSurface->pitch, dirtyRect.left, dirtyRect.top, dirtyRect.width(), dirtyRect.height());
 	}
-	g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(_dirtyRect->left, _dirtyRect->top), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
 
 	// Revert the colorMod-state.
 	_colorMod = oldColorMod;
 	
 	it = _renderQueue.begin();
 	// Clean out the old tickets
-	decrement = 0;
 	while (it != _renderQueue.end()) {
 		if ((*it)->_isValid == false) {
-			RenderTicket *ticket = *it;
 			addDirtyRect((*it)->_dstRect);
-			it = _renderQueue.erase(it);
-			delete ticket;
-			decrement++;
+			it = removeTicket(it);
 		} else {
-			(*it)->_drawNum -= decrement;
 			++it;
 		}
 	}
@@ -644,11 +677,9 @@ void BaseRenderOSystem::endSaveLoad() {
 	// Clear the scale-buffered tickets as we just loaded.
 	RenderQueueIterator it = _renderQueue.begin();
 	while (it != _renderQueue.end()) {
-		RenderTicket *ticket = *it;
-		it = _renderQueue.erase(it);
-		delete ticket;
+		it = removeTicket(it);
 	}
-	_lastAddedTicket = _renderQueue.begin();
+	_nextTicket = _renderQueue.begin();
 	_previousTicket = nullptr;
 	// HACK: After a save the buffer will be drawn before the scripts get to update it,
 	// so just skip this single frame.
@@ -33,6 +33,8 @@
 #include "common/rect.h"
 #include "graphics/surface.h"
 #include "common/list.h"
+#include "common/hashmap.h"
+#include "common/array.h"
 
 namespace Wintermute {
 class BaseSurfaceOSystem;
@@ -91,11 +93,30 @@ private:
 	// Dirty-rects:
 	void drawFromSurface(RenderTicket *ticket, Common::Rect *dstRect, Common::Rect *clipRect);
 	typedef Common::List<RenderTicket *>::iterator RenderQueueIterator;
-	Common::Rect *_dirtyRect;
+	typedef Common::HashMap<uint32, Common::Array<RenderTicket *> > RenderTicketIndex;
+	void queueTicket(RenderQueueIterator pos, RenderTicket *ticket);
+	RenderQueueIterator removeTicket(RenderQueueIterator it);
+	RenderTicket *findReusableTicket(RenderTicket &compare);
+	void startFrame();
+	// Areas of the screen to redraw, kept free of overlaps by addDirtyRect()
+	Common::Array<Common::Rect> _dirtyRects;
+	// Above this many rects, they are all combined into one
+	enum { kMaxDirtyRects = 16 };
 	Common::List<RenderTicket *> _renderQueue;
-	RenderQueueIterator _lastAddedTicket;
+	// The first ticket in the queue not drawn yet during this frame
+	RenderQueueIterator _nextTicket;
+	// All queued tickets by RenderTicket::getHash()
+	RenderTicketIndex _ticketIndex;
 	RenderTicket *_previousTicket;
 
+	struct TicketStats {
+		uint32 reused;		// drawn again in the same order as last frame
+		uint32 moved;		// drawn again, but in a different order
+		uint32 added;
+		uint32 removed;
+		uint32 redrawn;		// drawn to the screen surface
+	} _ticketStats;
+
 	bool _needsFlip;
 	uint32 _drawNum;
 	Common::Rect _renderRect;
@@ -431,8 +431,15 @@ bool BaseSurfaceOSystem::repeatLastDisplayOp(int offsetX, int offsetY, int numTi
 
 bool BaseSurfaceOSystem::putSurface(const Graphics::Surface &surface, bool hasAlpha) {
 	_loaded = true;
-	_surface->free();
-	_surface->copyFrom(surface);
+	if (_surface->pixels && _surface->w == surface.w && _surface->h == surface.h && _surface->format == surface.format) {
+		// Same size as before, e.g. the next frame of a video: reuse the buffer
+		for (int y = 0; y < surface.h; y++) {
+			memcpy(_surface->getBasePtr(0, y), surface.getBasePtr(0, y), surface.w * surface.format.bytesPerPixel);
+		}
+	} else {
+		_surface->free();
+		_surface->copyFrom(surface);
+	}
 	_hasAlpha = hasAlpha;
 	BaseRenderOSystem *renderer = static_cast<BaseRenderOSystem *>(_gameRef->_renderer);
 	renderer->invalidateTicketsFromSurface(this);
@@ -83,6 +83,22 @@ bool RenderTicket::operator==(RenderTicket &t) {
 	return true;
 }
 
+uint32 RenderTicket::getHash() const {
+	uint32 hash = (uint32)(size_t)_owner;
+	hash = hash * 31 + _dstRect.left;
+	hash = hash * 31 + _dstRect.top;
+	hash = hash * 31 + _dstRect.right;
+	hash = hash * 31 + _dstRect.bottom;
+	hash = hash * 31 + _srcRect.left;
+	hash = hash * 31 + _srcRect.top;
+	hash = hash * 31 + _srcRect.right;
+	hash = hash * 31 + _srcRect.bottom;
+	hash = hash * 31 + _mirror;
+	hash = hash * 31 + _hasAlpha;
+	hash = hash * 31 + _colorMod;
+	return hash;
+}
+
 // Replacement for SDL2's SDL_RenderCopy
 void RenderTicket::drawToSurface(Graphics::Surface *_targetSurface) {
 	TransparentSurface src(*getSurface(), false);
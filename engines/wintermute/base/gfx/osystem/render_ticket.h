@@ -31,6 +31,7 @@
 
 #include "graphics/surface.h"
 #include "common/rect.h"
+#include "common/list.h"
 
 namespace Wintermute {
 
@@ -56,6 +57,10 @@ public:
 
 	BaseSurfaceOSystem *_owner;
 	bool operator==(RenderTicket &a);
+	// Hash over the fields compared by operator==
+	uint32 getHash() const;
+	// Position in the render queue, while queued
+	Common::List<RenderTicket *>::iterator _queuePos;
 	const Common::Rect *getSrcRect() { return &_srcRect; }
 private:
 	Graphics::Surface *_surface;
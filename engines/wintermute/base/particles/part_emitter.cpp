@@ -34,6 +34,7 @@
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/base_region.h"
+#include "engines/wintermute/base/base_sprite.h"
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/base/gfx/base_renderer.h"
 #include "engines/wintermute/utils/utils.h"
@@ -100,6 +101,11 @@ PartEmitter::~PartEmitter(void) {
 	}
 	_particles.clear();
 
+	for (uint32 i = 0; i < _spareSprites.size(); i++) {
+		delete _spareSprites[i];
+	}
+	_spareSprites.clear();
+
 	for (uint32 i = 0; i < _forces.size(); i++) {
 		delete _forces[i];
 	}
@@ -236,7 +242,7 @@ bool PartEmitter::initParticle(PartParticle *particle, uint32 currentTime, uint3
 	particle->_angVelocity = angVelocity;
 	particle->_growthRate = growthRate;
 	particle->_exponentialGrowth = _exponentialGrowth;
-	particle->_isDead = DID_FAIL(particle->setSprite(_sprites[spriteIndex]));
+	particle->_isDead = DID_FAIL(setParticleSprite(particle, _sprites[spriteIndex]));
 	particle->fadeIn(currentTime, _fadeInTime);
 
 
@@ -261,6 +267,11 @@ bool PartEmitter::updateInternal(uint32 currentTime, uint32 timerDelta) {
 	int numLive = 0;
 
 	for (uint32 i = 0; i < _particles.size(); i++) {
+		// dead particles are fully reinitialized before they are reused
+		if (_particles[i]->_isDead) {
+			continue;
+		}
+
 		_particles[i]->update(this, currentTime, timerDelta);
 
 		if (!_particles[i]->_isDead) {
@@ -281,9 +292,11 @@ bool PartEmitter::updateInternal(uint32 currentTime, uint32 timerDelta) {
 			}
 
 			int toGen = MIN(_genAmount, _maxParticles - numLive);
+			// there are no dead slots before the last one reused
+			uint32 deadSearchStart = 0;
 			while (toGen > 0) {
 				int firstDeadIndex = -1;
-				for (uint32 i = 0; i < _particles.size(); i++) {
+				for (uint32 i = deadSearchStart; i < _particles.size(); i++) {
 					if (_particles[i]->_isDead) {
 						firstDeadIndex = i;
 						break;
@@ -293,6 +306,7 @@ bool PartEmitter::updateInternal(uint32 currentTime, uint32 timerDelta) {
 				PartParticle *particle;
 				if (firstDeadIndex >= 0) {
 					particle = _particles[firstDeadIndex];
+					deadSearchStart = firstDeadIndex;
 				} else {
 					particle = new PartParticle(_gameRef);
 					_particles.add(particle);
@@ -325,6 +339,10 @@ bool PartEmitter::display(BaseRegion *region) {
 	}
 
 	for (uint32 i = 0; i < _particles.size(); i++) {
+		if (_particles[i]->_isDead) {
+			continue;
+		}
+
 		if (region != nullptr && _useRegion) {
 			if (!region->pointInRegion((int)_particles[i]->_pos.x, (int)_particles[i]->_pos.y)) {
 				continue;
@@ -341,6 +359,36 @@ bool PartEmitter::display(BaseRegion *region) {
 	return STATUS_OK;
 }
 
+//////////////////////////////////////////////////////////////////////////
+bool PartEmitter::setParticleSprite(PartParticle *particle, const char *filename) {
+	BaseSprite *oldSprite = particle->_sprite;
+	if (oldSprite && oldSprite->getFilename() && scumm_stricmp(filename, oldSprite->getFilename()) == 0) {
+		return particle->setSprite(filename);
+	}
+
+	// park the current sprite, then look for a spare one of the wanted file
+	particle->_sprite = nullptr;
+	if (oldSprite) {
+		if (_spareSprites.size() >= kMaxSpareSprites) {
+			delete _spareSprites[0];
+			_spareSprites.remove_at(0);
+		}
+		_spareSprites.add(oldSprite);
+	}
+
+	for (uint32 i = 0; i < _spareSprites.size(); i++) {
+		BaseSprite *sprite = _spareSprites[i];
+		if (sprite->getFilename() && scumm_stricmp(filename, sprite->getFilename()) == 0) {
+			_spareSprites.remove_at(i);
+			particle->_sprite = sprite;
+			sprite->reset();
+			return STATUS_OK;
+		}
+	}
+
+	return particle->setSprite(filename);
+}
+
 //////////////////////////////////////////////////////////////////////////
 bool PartEmitter::start() {
 	for (uint32 i = 0; i < _particles.size(); i++) {
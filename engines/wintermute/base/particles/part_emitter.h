@@ -130,9 +130,15 @@ private:
 	bool static compareZ(const PartParticle *p1, const PartParticle *p2);
 	bool initParticle(PartParticle *particle, uint32 currentTime, uint32 timerDelta);
 	bool updateInternal(uint32 currentTime, uint32 timerDelta);
+	bool setParticleSprite(PartParticle *particle, const char *filename);
 	uint32 _lastGenTime;
 	BaseArray<PartParticle *> _particles;
 	BaseArray<char *> _sprites;
+
+	// Sprites taken from recycled particles, so a particle switching to
+	// another sprite file doesn't have to load it again
+	BaseArray<BaseSprite *> _spareSprites;
+	enum { kMaxSpareSprites = 32 };
 };
 
 } // end of namespace Wintermute
@@ -76,7 +76,7 @@ public:
 	ScScript *_waitScript;
 	TScriptState _state;
 	TScriptState _origState;
-	ScValue *getVar(char *name);
+	ScValue *getVar(uint32 symbol);
 	uint32 getFuncPos(const Common::String &name);
 	uint32 getEventPos(const Common::String &name) const;
 	uint32 getMethodPos(const Common::String &name) const;
@@ -149,6 +149,7 @@ public:
 	bool externalCall(ScStack *stack, ScStack *thisStack, ScScript::TExternalFunction *function);
 private:
 	char **_symbols;
+	Common::String *_symbolNames;	// _symbols as strings, so variable lookups don't rebuild them
 	uint32 _numSymbols;
 	TFunctionPos *_functions;
 	TMethodPos *_methods;
@@ -34,6 +34,7 @@
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/utils/utils.h"
+#include "common/algorithm.h"
 
 namespace Wintermute {
 
@@ -68,14 +69,14 @@ ScEngine::ScEngine(BaseGame *inGame) : BaseClass(inGame) {
 	}
 
 	// prepare script cache
-	for (int i = 0; i < MAX_CACHED_SCRIPTS; i++) {
-		_cachedScripts[i] = nullptr;
-	}
+	_cachedScriptsSize = 0;
+	_cacheClock = 0;
 
 	_currentScript = nullptr;
 
 	_isProfiling = false;
 	_profilingStartTime = 0;
+	memset(_instructionCounts, 0, sizeof(_instructionCounts));
 
 	//EnableProfiling();
 }
@@ -173,12 +174,11 @@ ScScript *ScEngine::runScript(const char *filename, BaseScriptHolder *owner) {
 byte *ScEngine::getCompiledScript(const char *filename, uint32 *outSize, bool ignoreCache) {
 	// is script in cache?
 	if (!ignoreCache) {
-		for (int i = 0; i < MAX_CACHED_SCRIPTS; i++) {
-			if (_cachedScripts[i] && scumm_stricmp(_cachedScripts[i]->_filename.c_str(), filename) == 0) {
-				_cachedScripts[i]->_timestamp = g_system->getMillis();
-				*outSize = _cachedScripts[i]->_size;
-				return _cachedScripts[i]->_buffer;
-			}
+		CachedScripts::iterator it = _cachedScripts.find(filename);
+		if (it != _cachedScripts.end()) {
+			it->_value->_timestamp = ++_cacheClock;
+			*outSize = it->_value->_size;
+			return it->_value->_buffer;
 		}
 	}
 
@@ -212,24 +212,19 @@ byte *ScEngine::getCompiledScript(const char *filename, uint32 *outSize, bool ig
 	byte *ret = nullptr;
 
 	// add script to cache
+	CachedScripts::iterator it = _cachedScripts.find(filename);
+	if (it != _cachedScripts.end()) {
+		_cachedScriptsSize -= it->_value->_size;
+		delete it->_value;
+		_cachedScripts.erase(it);
+	}
+	expireCachedScripts(compSize);
+
 	CScCachedScript *cachedScript = new CScCachedScript(filename, compBuffer, compSize);
 	if (cachedScript) {
-		int index = 0;
-		uint32 minTime = g_system->getMillis();
-		for (int i = 0; i < MAX_CACHED_SCRIPTS; i++) {
-			if (_cachedScripts[i] == nullptr) {
-				index = i;
-				break;
-			} else if (_cachedScripts[i]->_timestamp <= minTime) {
-				minTime = _cachedScripts[i]->_timestamp;
-				index = i;
-			}
-		}
-
-		if (_cachedScripts[index] != nullptr) {
-			delete _cachedScripts[index];
-		}
-		_cachedScripts[index] = cachedScript;
+		cachedScript->_timestamp = ++_cacheClock;
+		_cachedScripts[filename] = cachedScript;
+		_cachedScriptsSize += compSize;
 
 		ret = cachedScript->_buffer;
 		*outSize = cachedScript->_size;
@@ -244,6 +239,25 @@ byte *ScEngine::getCompiledScript(const char *filename, uint32 *outSize, bool ig
 
 
 
+//////////////////////////////////////////////////////////////////////////
+void ScEngine::expireCachedScripts(uint32 neededSize) {
+	// drop the least recently used scripts until the new one fits
+	while (!_cachedScripts.empty() &&
+	        (_cachedScripts.size() >= MAX_CACHED_SCRIPTS || _cachedScriptsSize + neededSize > MAX_CACHED_SCRIPTS_SIZE)) {
+		CachedScripts::iterator oldest = _cachedScripts.begin();
+		for (CachedScripts::iterator it = _cachedScripts.begin(); it != _cachedScripts.end(); ++it) {
+			if (it->_value->_timestamp < oldest->_value->_timestamp) {
+				oldest = it;
+			}
+		}
+
+		_cachedScriptsSize -= oldest->_value->_size;
+		delete oldest->_value;
+		_cachedScripts.erase(oldest);
+	}
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 bool ScEngine::tick() {
 	if (_scripts.size() == 0) {
@@ -326,12 +340,14 @@ bool ScEngine::tick() {
 		// time sliced script
 		if (_scripts[i]->_timeSlice > 0) {
 			uint32 startTime = g_system->getMillis();
+			uint32 instructions = 0;
 			while (_scripts[i]->_state == SCRIPT_RUNNING && g_system->getMillis() - startTime < _scripts[i]->_timeSlice) {
 				_currentScript = _scripts[i];
 				_scripts[i]->executeInstruction();
+				instructions++;
 			}
 			if (_isProfiling && _scripts[i]->_filename) {
-				addScriptTime(_scripts[i]->_filename, g_system->getMillis() - startTime);
+				addScriptTime(_scripts[i]->_filename, g_system->getMillis() - startTime, instructions);
 			}
 		}
 
@@ -343,12 +359,14 @@ bool ScEngine::tick() {
 				startTime = g_system->getMillis();
 			}
 
+			uint32 instructions = 0;
 			while (_scripts[i]->_state == SCRIPT_RUNNING) {
 				_currentScript = _scripts[i];
 				_scripts[i]->executeInstruction();
+				instructions++;
 			}
 			if (isProfiling && _scripts[i]->_filename) {
-				addScriptTime(_scripts[i]->_filename, g_system->getMillis() - startTime);
+				addScriptTime(_scripts[i]->_filename, g_system->getMillis() - startTime, instructions);
 			}
 		}
 		_currentScript = nullptr;
@@ -441,12 +459,11 @@ int ScEngine::getNumScripts(int *running, int *waiting, int *persistent) {
 
 //////////////////////////////////////////////////////////////////////////
 bool ScEngine::emptyScriptCache() {
-	for (int i = 0; i < MAX_CACHED_SCRIPTS; i++) {
-		if (_cachedScripts[i]) {
-			delete _cachedScripts[i];
-			_cachedScripts[i] = nullptr;
-		}
+	for (CachedScripts::iterator it = _cachedScripts.begin(); it != _cachedScripts.end(); ++it) {
+		delete it->_value;
 	}
+	_cachedScripts.clear();
+	_cachedScriptsSize = 0;
 	return STATUS_OK;
 }
 
@@ -544,14 +561,16 @@ bool ScEngine::clearGlobals(bool includingNatives) {
 }
 
 //////////////////////////////////////////////////////////////////////////
-void ScEngine::addScriptTime(const char *filename, uint32 time) {
+void ScEngine::addScriptTime(const char *filename, uint32 time, uint32 instructions) {
 	if (!_isProfiling) {
 		return;
 	}
 
 	AnsiString fileName = filename;
 	fileName.toLowercase();
-	_scriptTimes[fileName] += time;
+	ScriptProfile &profile = _scriptTimes[fileName];
+	profile.millis += time;
+	profile.instructions += instructions;
 }
 
 
@@ -563,6 +582,7 @@ void ScEngine::enableProfiling() {
 
 	// destroy old data, if any
 	_scriptTimes.clear();
+	memset(_instructionCounts, 0, sizeof(_instructionCounts));
 
 	_profilingStartTime = g_system->getMillis();
 	_isProfiling = true;
@@ -581,28 +601,78 @@ void ScEngine::disableProfiling() {
 
 
 //////////////////////////////////////////////////////////////////////////
-void ScEngine::dumpStats() {
-	error("DumpStats not ported to ScummVM yet");
-	/*  uint32 totalTime = g_system->getMillis() - _profilingStartTime;
+static const char *const instructionNames[] = {
+	"DEF_VAR", "DEF_GLOB_VAR", "RET", "RET_EVENT", "CALL", "CALL_BY_EXP",
+	"EXTERNAL_CALL", "SCOPE", "CORRECT_STACK", "CREATE_OBJECT", "POP_EMPTY",
+	"PUSH_VAR", "PUSH_VAR_REF", "POP_VAR", "PUSH_VAR_THIS", "PUSH_INT",
+	"PUSH_BOOL", "PUSH_FLOAT", "PUSH_STRING", "PUSH_NULL", "PUSH_THIS_FROM_STACK",
+	"PUSH_THIS", "POP_THIS", "PUSH_BY_EXP", "POP_BY_EXP", "JMP", "JMP_FALSE",
+	"ADD", "SUB", "MUL", "DIV", "MODULO", "NOT", "AND", "OR", "CMP_EQ",
+	"CMP_NE", "CMP_L", "CMP_G", "CMP_LE", "CMP_GE", "CMP_STRICT_EQ",
+	"CMP_STRICT_NE", "DBG_LINE", "POP_REG1", "PUSH_REG1", "DEF_CONST_VAR"
+};
+
+struct ProfileEntry {
+	const char *name;
+	uint32 millis;
+	uint32 count;
+
+	bool operator<(const ProfileEntry &other) const {
+		return millis > other.millis || (millis == other.millis && count > other.count);
+	}
+};
+
+void ScEngine::getStats(Common::StringArray &lines, uint maxEntries) {
+	assert(ARRAYSIZE(instructionNames) == kNumInstructions);
+
+	uint32 totalTime = g_system->getMillis() - _profilingStartTime;
+	lines.push_back(Common::String::format("%-40s %.3fs", "Total profiling time", (float)totalTime / 1000));
+
+	// hottest scripts
+	Common::Array<ProfileEntry> entries;
+	for (ScriptTimes::iterator it = _scriptTimes.begin(); it != _scriptTimes.end(); ++it) {
+		ProfileEntry entry = { it->_key.c_str(), it->_value.millis, it->_value.instructions };
+		entries.push_back(entry);
+	}
+	Common::sort(entries.begin(), entries.end());
+
+	lines.push_back("Scripts by execution time:");
+	for (uint i = 0; i < entries.size() && i < maxEntries; i++) {
+		lines.push_back(Common::String::format("  %-40s %.3fs (%.1f%%) %u instructions", entries[i].name,
+		                                       (float)entries[i].millis / 1000, totalTime ? (float)entries[i].millis / totalTime * 100 : 0.0f, entries[i].count));
+	}
 
-	    typedef std::vector <std::pair<uint32, std::string> > TimeVector;
-	    TimeVector times;
+	// hottest opcodes
+	entries.clear();
+	uint32 totalInstructions = 0;
+	for (uint i = 0; i < kNumInstructions; i++) {
+		if (_instructionCounts[i]) {
+			ProfileEntry entry = { instructionNames[i], _instructionCounts[i], _instructionCounts[i] };
+			entries.push_back(entry);
+			totalInstructions += _instructionCounts[i];
+		}
+	}
+	Common::sort(entries.begin(), entries.end());
 
-	    ScriptTimes::iterator it;
-	    for (it = _scriptTimes.begin(); it != _scriptTimes.end(); ++it) {
-	        times.push_back(std::pair<uint32, std::string> (it->_value, it->_key));
-	    }
-	    std::sort(times.begin(), times.end());
+	lines.push_back("Instructions by count:");
+	for (uint i = 0; i < entries.size() && i < maxEntries; i++) {
+		lines.push_back(Common::String::format("  %-40s %u (%.1f%%)", entries[i].name, entries[i].count,
+		                                       (float)entries[i].count / totalInstructions * 100));
+	}
 
+	lines.push_back(Common::String::format("Script cache: %u scripts, %u bytes", _cachedScripts.size(), _cachedScriptsSize));
+}
 
-	    TimeVector::reverse_iterator tit;
 
-	    _gameRef->LOG(0, "***** Script profiling information: *****");
-	    _gameRef->LOG(0, "  %-40s %fs", "Total execution time", (float)totalTime / 1000);
+//////////////////////////////////////////////////////////////////////////
+void ScEngine::dumpStats() {
+	Common::StringArray lines;
+	getStats(lines);
 
-	    for (tit = times.rbegin(); tit != times.rend(); ++tit) {
-	        _gameRef->LOG(0, "  %-40s %fs (%f%%)", tit->second.c_str(), (float)tit->first / 1000, (float)tit->first / (float)totalTime * 100);
-	    }*/
+	_gameRef->LOG(0, "***** Script profiling information: *****");
+	for (uint i = 0; i < lines.size(); i++) {
+		_gameRef->LOG(0, "  %s", lines[i].c_str());
+	}
 }
 
 } // end of namespace Wintermute
@@ -32,10 +32,14 @@
 #include "engines/wintermute/persistent.h"
 #include "engines/wintermute/coll_templ.h"
 #include "engines/wintermute/base/base.h"
+#include "engines/wintermute/base/scriptables/dcscript.h"
+#include "common/str-array.h"
 
 namespace Wintermute {
 
-#define MAX_CACHED_SCRIPTS 20
+// The compiled script cache is bounded both by count and by total size
+#define MAX_CACHED_SCRIPTS 256
+#define MAX_CACHED_SCRIPTS_SIZE (4 * 1024 * 1024)
 class ScScript;
 class ScValue;
 class BaseObject;
@@ -60,7 +64,7 @@ public:
 			}
 		};
 
-		uint32 _timestamp;
+		uint32 _timestamp;	// value of ScEngine::_cacheClock at the last use
 		byte *_buffer;
 		uint32 _size;
 		Common::String _filename;
@@ -116,17 +120,38 @@ public:
 		return _isProfiling;
 	}
 
-	void addScriptTime(const char *filename, uint32 Time);
+	void addScriptTime(const char *filename, uint32 Time, uint32 instructions = 0);
+	void addInstruction(uint32 inst) {
+		if (inst < kNumInstructions) {
+			_instructionCounts[inst]++;
+		}
+	}
+	void getStats(Common::StringArray &lines, uint maxEntries = 20);
 	void dumpStats();
 
 private:
+	enum {
+		kNumInstructions = II_DEF_CONST_VAR + 1
+	};
+
+	typedef Common::HashMap<Common::String, CScCachedScript *, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> CachedScripts;
+	CachedScripts _cachedScripts;
+	uint32 _cachedScriptsSize;
+	uint32 _cacheClock;
+	void expireCachedScripts(uint32 neededSize);
 
-	CScCachedScript *_cachedScripts[MAX_CACHED_SCRIPTS];
 	bool _isProfiling;
 	uint32 _profilingStartTime;
 
-	typedef Common::HashMap<Common::String, uint32> ScriptTimes;
+	struct ScriptProfile {
+		uint32 millis;
+		uint32 instructions;
+
+		ScriptProfile() : millis(0), instructions(0) {}
+	};
+	typedef Common::HashMap<Common::String, ScriptProfile> ScriptTimes;
 	ScriptTimes _scriptTimes;
+	uint32 _instructionCounts[kNumInstructions];
 
 };
 
@@ -159,11 +159,17 @@ ScValue::~ScValue() {
 
 //////////////////////////////////////////////////////////////////////////
 ScValue *ScValue::getProp(const char *name) {
+	return getProp(Common::String(name));
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+ScValue *ScValue::getProp(const Common::String &name) {
 	if (_type == VAL_VARIABLE_REF) {
 		return _valRef->getProp(name);
 	}
 
-	if (_type == VAL_STRING && strcmp(name, "Length") == 0) {
+	if (_type == VAL_STRING && name == "Length") {
 		_gameRef->_scValue->_type = VAL_INT;
 
 		if (_gameRef->_textEncoding == TEXT_ANSI) {
@@ -191,6 +197,20 @@ ScValue *ScValue::getProp(const char *name) {
 	return ret;
 }
 
+
+//////////////////////////////////////////////////////////////////////////
+ScValue *ScValue::findProp(const Common::String &name) {
+	if (_type == VAL_VARIABLE_REF) {
+		return _valRef->findProp(name);
+	}
+
+	_valIter = _valObject.find(name);
+	if (_valIter != _valObject.end()) {
+		return _valIter->_value;
+	}
+	return nullptr;
+}
+
 //////////////////////////////////////////////////////////////////////////
 bool ScValue::deleteProp(const char *name) {
 	if (_type == VAL_VARIABLE_REF) {
@@ -261,6 +281,12 @@ bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAs
 
 //////////////////////////////////////////////////////////////////////////
 bool ScValue::propExists(const char *name) {
+	return propExists(Common::String(name));
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool ScValue::propExists(const Common::String &name) {
 	if (_type == VAL_VARIABLE_REF) {
 		return _valRef->propExists(name);
 	}
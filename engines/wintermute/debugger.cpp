@@ -25,12 +25,14 @@
 #include "engines/wintermute/base/base_engine.h"
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/base/base_game.h"
+#include "engines/wintermute/base/scriptables/script_engine.h"
 
 namespace Wintermute {
 
 Console::Console(WintermuteEngine *vm) : GUI::Debugger(), _engineRef(vm) {
 	DCmd_Register("show_fps", WRAP_METHOD(Console, Cmd_ShowFps));
 	DCmd_Register("dump_file", WRAP_METHOD(Console, Cmd_DumpFile));
+	DCmd_Register("script_profile", WRAP_METHOD(Console, Cmd_ScriptProfile));
 }
 
 Console::~Console(void) {
@@ -81,4 +83,35 @@ bool Console::Cmd_DumpFile(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::Cmd_ScriptProfile(int argc, const char **argv) {
+	ScEngine *scEngine = _engineRef->_game->_scEngine;
+	if (argc > 1) {
+		Common::String arg = argv[1];
+		if (arg == "on") {
+			scEngine->enableProfiling();
+			DebugPrintf("Script profiling enabled\n");
+			return true;
+		} else if (arg == "off") {
+			scEngine->disableProfiling();
+			DebugPrintf("Script profiling disabled, statistics written to the log\n");
+			return true;
+		} else if (arg != "show") {
+			DebugPrintf("Usage: %s [on|off|show]\n", argv[0]);
+			return true;
+		}
+	}
+
+	if (!scEngine->getIsProfiling()) {
+		DebugPrintf("Script profiling is off, use '%s on' to start it\n", argv[0]);
+		return true;
+	}
+
+	Common::StringArray lines;
+	scEngine->getStats(lines);
+	for (uint i = 0; i < lines.size(); i++) {
+		DebugPrintf("%s\n", lines[i].c_str());
+	}
+	return true;
+}
+
 } // end of namespace Wintermute
@@ -27,6 +27,13 @@
 #include "graphics/primitives.h"
 #include "engines/wintermute/graphics/transparent_surface.h"
 
+// SSE2 is always there on x86-64, and any other compiler targeting it
+// announces it the same way, so no runtime check is needed.
+#if defined(__SSE2__) && defined(SCUMM_LITTLE_ENDIAN)
+#define WINTERMUTE_BLIT_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace Wintermute {
 
 byte *TransparentSurface::_lookup = nullptr;
@@ -62,16 +69,85 @@ void doBlitOpaque(byte *ino, byte* outo, uint32 width, uint32 height, uint32 pit
 	for (uint32 i = 0; i < height; i++) {
 		out = outo;
 		in = ino;
-		memcpy(out, in, width * 4);
-		for (uint32 j = 0; j < width; j++) {
-			out[aIndex] = 0xFF;
-			out += 4;
+		if (inStep > 0) {
+			memcpy(out, in, width * 4);
+			for (uint32 j = 0; j < width; j++) {
+				out[aIndex] = 0xFF;
+				out += 4;
+			}
+		} else {
+			// Mirrored, so copy pixel by pixel from the end of the line
+			for (uint32 j = 0; j < width; j++) {
+				WRITE_UINT32(out, READ_UINT32(in));
+				out[aIndex] = 0xFF;
+				out += 4;
+				in += inStep;
+			}
 		}
 		outo += pitch;
 		ino += inoStep;
 	}
 }
 
+#ifdef WINTERMUTE_BLIT_SSE2
+/**
+ * Alpha blend the start of a line four pixels at a time. Gives exactly the
+ * same result as the lookup table in doBlitAlpha():
+ * out = (dst * (255 - a) >> 8) + (src * a >> 8), with alpha 0 and 255
+ * leaving dst alone and copying src respectively.
+ * @return the number of pixels done; the rest is left to the caller
+ */
+static uint32 doBlitAlphaSSE2(const byte *in, byte *out, uint32 width, int32 inStep) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i alphaMask = _mm_set1_epi32((int)0xFF000000);
+	const __m128i max = _mm_set1_epi16(255);
+	uint32 j;
+
+	for (j = 0; j + 4 <= width; j += 4) {
+		__m128i src;
+		if (inStep > 0) {
+			src = _mm_loadu_si128((const __m128i *)in);
+		} else {
+			// Mirrored: load the four pixels ending here and reverse them
+			src = _mm_loadu_si128((const __m128i *)(in - 12));
+			src = _mm_shuffle_epi32(src, _MM_SHUFFLE(0, 1, 2, 3));
+		}
+		in += inStep * 4;
+
+		const __m128i srcAlpha = _mm_and_si128(src, alphaMask);
+		const __m128i transparent = _mm_cmpeq_epi32(srcAlpha, zero);
+		if (_mm_movemask_epi8(transparent) == 0xFFFF) {
+			out += 16;
+			continue;
+		}
+		const __m128i opaque = _mm_cmpeq_epi32(srcAlpha, alphaMask);
+		const __m128i dst = _mm_loadu_si128((const __m128i *)out);
+
+		// Spread each pixel's alpha over all four of its bytes
+		__m128i a = _mm_srli_epi32(src, 24);
+		a = _mm_or_si128(a, _mm_slli_epi32(a, 8));
+		a = _mm_or_si128(a, _mm_slli_epi32(a, 16));
+
+		const __m128i aLo = _mm_unpacklo_epi8(a, zero);
+		const __m128i aHi = _mm_unpackhi_epi8(a, zero);
+		__m128i lo = _mm_add_epi16(
+			_mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(dst, zero), _mm_sub_epi16(max, aLo)), 8),
+			_mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(src, zero), aLo), 8));
+		__m128i hi = _mm_add_epi16(
+			_mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(dst, zero), _mm_sub_epi16(max, aHi)), 8),
+			_mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(src, zero), aHi), 8));
+		__m128i result = _mm_or_si128(_mm_packus_epi16(lo, hi), alphaMask);
+
+		result = _mm_or_si128(_mm_and_si128(opaque, src), _mm_andnot_si128(opaque, result));
+		result = _mm_or_si128(_mm_and_si128(transparent, dst), _mm_andnot_si128(transparent, result));
+		_mm_storeu_si128((__m128i *)out, result);
+		out += 16;
+	}
+
+	return j;
+}
+#endif
+
 void TransparentSurface::generateLookup() {
 	_lookup = new byte[256 * 256];
 	for (int i = 0; i < 256; i++) {
@@ -112,7 +188,13 @@ void TransparentSurface::doBlitAlpha(byte *ino, byte* outo, uint32 width, uint32
 	for (uint32 i = 0; i < height; i++) {
 		out = outo;
 		in = ino;
-		for (uint32 j = 0; j < width; j++) {
+		uint32 j = 0;
+#ifdef WINTERMUTE_BLIT_SSE2
+		j = doBlitAlphaSSE2(in, out, width, inStep);
+		in += (int32)j * inStep;
+		out += j * 4;
+#endif
+		for (; j < width; j++) {
 			uint32 pix = *(uint32 *)in;
 			uint32 oPix = *(uint32 *) out;
 			int b = (pix >> bShift) & 0xff;
@@ -403,13 +485,21 @@ TransparentSurface *TransparentSurface::scale(const Common::Rect &srcRect, const
 
 	target->create((uint16)dstW, (uint16)dstH, this->format);
 
+	// The source column is the same for every line, so only work it out once
+	int *srcX = new int[dstW];
+	for (int x = 0; x < dstW; x++) {
+		srcX[x] = (x * srcW / dstW + srcRect.left) * 4;
+	}
+
 	for (int y = 0; y < dstH; y++) {
+		const byte *src = (const byte *)getBasePtr(0, y * srcH / dstH + srcRect.top);
+		byte *dst = (byte *)target->getBasePtr(dstRect.left, y + dstRect.top);
 		for (int x = 0; x < dstW; x++) {
-			uint32 color = READ_UINT32((const byte *)getBasePtr(x * srcW / dstW + srcRect.left,
-														  y * srcH / dstH + srcRect.top));
-			WRITE_UINT32((byte *)target->getBasePtr(x + dstRect.left, y + dstRect.top), color);
+			WRITE_UINT32(dst, READ_UINT32(src + srcX[x]));
+			dst += 4;
 		}
 	}
+	delete[] srcX;
 	return target;
 
 }
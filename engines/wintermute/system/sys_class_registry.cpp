@@ -284,6 +284,14 @@ bool SystemClassRegistry::loadInstances(BaseGame *gameRef, BasePersistenceManage
 	// get total instances
 	int numInstances = persistMgr->getDWORD();
 
+	// class lookup by saved ID, instead of scanning all classes per instance
+	Common::HashMap<int, SystemClass *> savedClasses;
+	for (Classes::iterator it = _classes.begin(); it != _classes.end(); ++it) {
+		if (!savedClasses.contains((it->_value)->getSavedID())) {
+			savedClasses[(it->_value)->getSavedID()] = it->_value;
+		}
+	}
+
 	for (int i = 0; i < numInstances; i++) {
 		if (i % 20 == 0) {
 			gameRef->_renderer->setIndicatorVal((int)(50.0f + 50.0f / (float)((float)numInstances / (float)i)));
@@ -297,12 +305,9 @@ bool SystemClassRegistry::loadInstances(BaseGame *gameRef, BasePersistenceManage
 
 		checkHeader("</INSTANCE_HEAD>", persistMgr);
 
-		Classes::iterator it;
-		for (it = _classes.begin(); it != _classes.end(); ++it) {
-			if ((it->_value)->getSavedID() == classID) {
-				(it->_value)->loadInstance(instance, persistMgr);
-				break;
-			}
+		Common::HashMap<int, SystemClass *>::iterator classIt = savedClasses.find(classID);
+		if (classIt != savedClasses.end()) {
+			(classIt->_value)->loadInstance(instance, persistMgr);
 		}
 		checkHeader("</INSTANCE>", persistMgr);
 	}
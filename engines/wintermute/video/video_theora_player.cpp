@@ -209,8 +209,10 @@ bool VideoTheoraPlayer::play(TVideoPlayback type, int x, int y, bool freezeGame,
 	_playbackStarted = false;
 	float width, height;
 	if (_theoraDecoder) {
-		_surface.free();
-		_surface.copyFrom(*_theoraDecoder->decodeNextFrame());
+		const Graphics::Surface *decodedFrame = _theoraDecoder->decodeNextFrame();
+		if (decodedFrame) {
+			writeVideo(*decodedFrame);
+		}
 		_state = THEORA_STATE_PLAYING;
 		_looping = looping;
 		_playbackType = type;
@@ -306,11 +308,7 @@ bool VideoTheoraPlayer::update() {
 			if (!_theoraDecoder->endOfVideo() && _theoraDecoder->getTimeToNextFrame() == 0) {
 				const Graphics::Surface *decodedFrame = _theoraDecoder->decodeNextFrame();
 				if (decodedFrame) {
-					_surface.free();
-					_surface.copyFrom(*decodedFrame);
-					if (_texture) {
-						writeVideo();
-					}
+					writeVideo(*decodedFrame);
 				}
 			}
 			return STATUS_OK;
@@ -344,18 +342,28 @@ uint32 VideoTheoraPlayer::getMovieTime() {
 }
 
 //////////////////////////////////////////////////////////////////////////
-bool VideoTheoraPlayer::writeVideo() {
+bool VideoTheoraPlayer::writeVideo(const Graphics::Surface &frame) {
 	if (!_texture) {
 		return STATUS_FAILED;
 	}
 
 	_texture->startPixelOp();
 
-	writeAlpha();
 	if (_alphaImage) {
+		// The alpha mask is applied to our own copy of the frame
+		if (_surface.w == frame.w && _surface.h == frame.h && _surface.format == frame.format) {
+			for (int y = 0; y < frame.h; y++) {
+				memcpy(_surface.getBasePtr(0, y), frame.getBasePtr(0, y), frame.w * frame.format.bytesPerPixel);
+			}
+		} else {
+			_surface.free();
+			_surface.copyFrom(frame);
+		}
+		writeAlpha();
 		_texture->putSurface(_surface, true);
 	} else {
-		_texture->putSurface(_surface, false);
+		// Nothing to change, upload the decoder's frame directly
+		_texture->putSurface(frame, false);
 	}
 
 	//RenderFrame(_texture, &yuv);
@@ -134,7 +134,7 @@ private:
 	bool _videoFrameReady;
 	float _videobufTime;
 
-	bool writeVideo();
+	bool writeVideo(const Graphics::Surface &frame);
 
 	bool _playbackStarted;
 